@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BTService_AcquireTarget.h"
+#include "AIController.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
+#include "MultiShootGame/Subsystem/EnemyPerceptionSubsystem.h"
+
+UBTService_AcquireTarget::UBTService_AcquireTarget()
+{
+	NodeName = "Acquire Target";
+
+	bNotifyTick = true;
+	bTickIntervals = true;
+	Interval = NearInterval;
+	RandomDeviation = 0.05f;
+
+	BlackboardKey.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(UBTService_AcquireTarget, BlackboardKey),
+	                              APawn::StaticClass());
+}
+
+void UBTService_AcquireTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
+	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
+
+	const AAIController* AIController = OwnerComp.GetAIOwner();
+	const AMultiShootGameEnemyCharacter* EnemyCharacter = AIController
+		                                                      ? Cast<AMultiShootGameEnemyCharacter>(
+			                                                      AIController->GetPawn())
+		                                                      : nullptr;
+	const UEnemyPerceptionSubsystem* EnemyPerceptionSubsystem = OwnerComp.GetWorld()->GetSubsystem<
+		UEnemyPerceptionSubsystem>();
+	if (EnemyCharacter == nullptr || EnemyPerceptionSubsystem == nullptr)
+	{
+		return;
+	}
+
+	// The player list is gathered once per frame for every bot, only the per-bot choice happens here
+	APawn* BestTarget = nullptr;
+	float BestDistanceSquared = MAX_FLT;
+	for (APawn* Target : EnemyPerceptionSubsystem->GetPlayerTargets())
+	{
+		if (!AMultiShootGamePlayerState::IsSameMatch(EnemyCharacter, Target))
+		{
+			continue;
+		}
+
+		if (UHealthComponent::GetTeamAttitude(EnemyCharacter, Target) != ETeamAttitude::Hostile)
+		{
+			continue;
+		}
+
+		if (bRequireVisible && !EnemyPerceptionSubsystem->CanSee(EnemyCharacter, Target))
+		{
+			continue;
+		}
+
+		const float DistanceSquared = FVector::DistSquared(EnemyCharacter->GetActorLocation(),
+		                                                   Target->GetActorLocation());
+		if (DistanceSquared < BestDistanceSquared)
+		{
+			BestDistanceSquared = DistanceSquared;
+			BestTarget = Target;
+		}
+	}
+
+	OwnerComp.GetBlackboardComponent()->SetValueAsObject(GetSelectedBlackboardKey(), BestTarget);
+
+	SetNextTickTime(NodeMemory, BestDistanceSquared <= FMath::Square(NearDistance) ? NearInterval : FarInterval);
+}
+
+FString UBTService_AcquireTarget::GetStaticDescription() const
+{
+	return FString::Printf(TEXT("%s: %s\nNear %.2fs, far %.2fs"), *Super::GetStaticDescription(),
+	                       bRequireVisible ? TEXT("visible players") : TEXT("any player"), NearInterval, FarInterval);
+}
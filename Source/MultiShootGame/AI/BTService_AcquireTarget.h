@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/Services/BTService_BlackboardBase.h"
+#include "BTService_AcquireTarget.generated.h"
+
+/**
+ * Picks the closest player for the bot from the per-frame target cache of UEnemyPerceptionSubsystem.
+ * Ticks at NearInterval while a target is close and at FarInterval otherwise.
+ */
+UCLASS()
+class MULTISHOOTGAME_API UBTService_AcquireTarget : public UBTService_BlackboardBase
+{
+	GENERATED_BODY()
+
+public:
+	UBTService_AcquireTarget();
+
+protected:
+	/**
+	 * Only pick players the bot can see. Visibility comes from UEnemyPerceptionSubsystem::CanSee, which uses the
+	 * shared sight cache when the bot opted into it and a direct line of sight trace otherwise.
+	 */
+	UPROPERTY(EditAnywhere, Category = Target)
+	bool bRequireVisible = true;
+
+	UPROPERTY(EditAnywhere, Category = Target)
+	float NearDistance = 2500.f;
+
+	UPROPERTY(EditAnywhere, Category = Target)
+	float NearInterval = 0.2f;
+
+	UPROPERTY(EditAnywhere, Category = Target)
+	float FarInterval = 1.f;
+
+	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+
+	virtual FString GetStaticDescription() const override;
+};
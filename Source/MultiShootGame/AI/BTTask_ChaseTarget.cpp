@@ -0,0 +1,160 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BTTask_ChaseTarget.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "MultiShootGame/Subsystem/PathCacheSubsystem.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "NavMesh/NavMeshPath.h"
+
+UBTTask_ChaseTarget::UBTTask_ChaseTarget()
+{
+	NodeName = "Chase Target";
+
+	bNotifyTick = true;
+
+	BlackboardKey.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(UBTTask_ChaseTarget, BlackboardKey),
+	                              AActor::StaticClass());
+}
+
+bool UBTTask_ChaseTarget::RequestPath(UBehaviorTreeComponent& OwnerComp, FBTChaseTargetMemory* Memory) const
+{
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	const APawn* Pawn = AIController ? AIController->GetPawn() : nullptr;
+	const AActor* Target = Cast<AActor>(
+		OwnerComp.GetBlackboardComponent()->GetValueAsObject(GetSelectedBlackboardKey()));
+	UPathCacheSubsystem* PathCacheSubsystem = OwnerComp.GetWorld()->GetSubsystem<UPathCacheSubsystem>();
+	if (Pawn == nullptr || Target == nullptr || PathCacheSubsystem == nullptr)
+	{
+		return false;
+	}
+
+	const APawn* TargetPawn = Cast<APawn>(Target);
+	Memory->Goal = TargetPawn ? TargetPawn->GetNavAgentLocation() : Target->GetActorLocation();
+	Memory->RepathTime = 0.f;
+
+	TArray<FVector> PathPoints;
+	if (PathCacheSubsystem->RequestPath(Pawn->GetNavAgentLocation(), Memory->Goal, PathPoints, Memory->RequestId))
+	{
+		Memory->bMoving = StartMove(AIController, PathPoints, Memory->Goal);
+		return Memory->bMoving;
+	}
+
+	return true;
+}
+
+bool UBTTask_ChaseTarget::StartMove(AAIController* AIController, const TArray<FVector>& PathPoints,
+                                    const FVector& Goal) const
+{
+	UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(
+		AIController->GetWorld());
+	if (NavigationSystem == nullptr || PathPoints.Num() < 2)
+	{
+		return false;
+	}
+
+	// Every bot follows its own copy because path following advances through the points it was given
+	const TSharedRef<FNavMeshPath> Path = MakeShared<FNavMeshPath>();
+	Path->SetNavigationDataUsed(NavigationSystem->GetDefaultNavDataInstance());
+	for (const FVector& PathPoint : PathPoints)
+	{
+		Path->GetPathPoints().Add(FNavPathPoint(PathPoint));
+	}
+	Path->MarkReady();
+
+	FAIMoveRequest MoveRequest(Goal);
+	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+
+	return AIController->RequestMove(MoveRequest, Path).IsValid();
+}
+
+EBTNodeResult::Type UBTTask_ChaseTarget::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	FBTChaseTargetMemory* Memory = CastInstanceNodeMemory<FBTChaseTargetMemory>(NodeMemory);
+	Memory->RequestId = INDEX_NONE;
+	Memory->bMoving = false;
+	Memory->ElapsedTime = 0.f;
+
+	if (!RequestPath(OwnerComp, Memory))
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	AIController->SetFocus(Cast<AActor>(
+		OwnerComp.GetBlackboardComponent()->GetValueAsObject(GetSelectedBlackboardKey())));
+
+	return EBTNodeResult::InProgress;
+}
+
+EBTNodeResult::Type UBTTask_ChaseTarget::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	if (AIController)
+	{
+		AIController->StopMovement();
+	}
+
+	return EBTNodeResult::Aborted;
+}
+
+void UBTTask_ChaseTarget::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
+	FBTChaseTargetMemory* Memory = CastInstanceNodeMemory<FBTChaseTargetMemory>(NodeMemory);
+	Memory->ElapsedTime += DeltaSeconds;
+	Memory->RepathTime += DeltaSeconds;
+
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	UPathCacheSubsystem* PathCacheSubsystem = OwnerComp.GetWorld()->GetSubsystem<UPathCacheSubsystem>();
+	if (AIController == nullptr || PathCacheSubsystem == nullptr)
+	{
+		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+		return;
+	}
+
+	if (Memory->RequestId != INDEX_NONE)
+	{
+		TArray<FVector> PathPoints;
+		bool bSuccess = false;
+		if (PathCacheSubsystem->ConsumeResult(Memory->RequestId, PathPoints, bSuccess))
+		{
+			Memory->RequestId = INDEX_NONE;
+			Memory->bMoving = bSuccess && StartMove(AIController, PathPoints, Memory->Goal);
+			if (!Memory->bMoving)
+			{
+				FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+			}
+		}
+		return;
+	}
+
+	if (Memory->ElapsedTime >= MaxDuration)
+	{
+		AIController->StopMovement();
+		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
+		return;
+	}
+
+	if (AIController->GetMoveStatus() == EPathFollowingStatus::Idle)
+	{
+		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
+		return;
+	}
+
+	const AActor* Target = Cast<AActor>(
+		OwnerComp.GetBlackboardComponent()->GetValueAsObject(GetSelectedBlackboardKey()));
+	if (Target && Memory->RepathTime >= RepathInterval &&
+		FVector::DistSquared(Target->GetActorLocation(), Memory->Goal) > FMath::Square(RepathDistance))
+	{
+		if (!RequestPath(OwnerComp, Memory))
+		{
+			FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+		}
+	}
+}
+
+uint16 UBTTask_ChaseTarget::GetInstanceMemorySize() const
+{
+	return sizeof(FBTChaseTargetMemory);
+}
@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/Tasks/BTTask_BlackboardBase.h"
+#include "BTTask_ChaseTarget.generated.h"
+
+class AAIController;
+
+struct FBTChaseTargetMemory
+{
+	int RequestId;
+
+	bool bMoving;
+
+	float ElapsedTime;
+
+	float RepathTime;
+
+	FVector Goal;
+};
+
+/**
+ * Moves towards the target in BlackboardKey using paths from UPathCacheSubsystem.
+ */
+UCLASS()
+class MULTISHOOTGAME_API UBTTask_ChaseTarget : public UBTTask_BlackboardBase
+{
+	GENERATED_BODY()
+
+public:
+	UBTTask_ChaseTarget();
+
+protected:
+	UPROPERTY(EditAnywhere, Category = Move)
+	float AcceptanceRadius = 300.f;
+
+	UPROPERTY(EditAnywhere, Category = Move)
+	float RepathDistance = 300.f;
+
+	UPROPERTY(EditAnywhere, Category = Move)
+	float RepathInterval = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category = Move)
+	float MaxDuration = 10.f;
+
+	bool RequestPath(UBehaviorTreeComponent& OwnerComp, FBTChaseTargetMemory* Memory) const;
+
+	bool StartMove(AAIController* AIController, const TArray<FVector>& PathPoints, const FVector& Goal) const;
+
+	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+
+	virtual uint16 GetInstanceMemorySize() const override;
+};
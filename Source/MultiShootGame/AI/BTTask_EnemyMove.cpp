@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BTTask_EnemyMove.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "Navigation/PathFollowingComponent.h"
+
+UBTTask_EnemyMove::UBTTask_EnemyMove()
+{
+	bNotifyTick = true;
+
+	BlackboardKey.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(UBTTask_EnemyMove, BlackboardKey),
+	                              AActor::StaticClass());
+}
+
+bool UBTTask_EnemyMove::ProjectToNavigation(const APawn* Pawn, const FVector& Location, FVector& OutLocation) const
+{
+	const UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(
+		Pawn->GetWorld());
+	FNavLocation NavLocation;
+	if (NavigationSystem == nullptr || !NavigationSystem->ProjectPointToNavigation(Location, NavLocation))
+	{
+		return false;
+	}
+
+	OutLocation = NavLocation.Location;
+
+	return true;
+}
+
+EBTNodeResult::Type UBTTask_EnemyMove::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	APawn* Pawn = AIController ? AIController->GetPawn() : nullptr;
+	AActor* Target = Cast<AActor>(OwnerComp.GetBlackboardComponent()->GetValueAsObject(GetSelectedBlackboardKey()));
+	if (Pawn == nullptr)
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	FVector Destination;
+	if (!FindDestination(Pawn, Target, Destination))
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	if (bFocusTarget && Target)
+	{
+		AIController->SetFocus(Target);
+	}
+
+	CastInstanceNodeMemory<FBTEnemyMoveMemory>(NodeMemory)->ElapsedTime = 0.f;
+
+	switch (AIController->MoveToLocation(Destination, AcceptanceRadius, true, true, true, false))
+	{
+	case EPathFollowingRequestResult::AlreadyAtGoal:
+		return EBTNodeResult::Succeeded;
+	case EPathFollowingRequestResult::RequestSuccessful:
+		return EBTNodeResult::InProgress;
+	default:
+		return EBTNodeResult::Failed;
+	}
+}
+
+EBTNodeResult::Type UBTTask_EnemyMove::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	if (AIController)
+	{
+		AIController->StopMovement();
+	}
+
+	return EBTNodeResult::Aborted;
+}
+
+void UBTTask_EnemyMove::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
+	FBTEnemyMoveMemory* Memory = CastInstanceNodeMemory<FBTEnemyMoveMemory>(NodeMemory);
+	Memory->ElapsedTime += DeltaSeconds;
+
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	if (AIController == nullptr)
+	{
+		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+		return;
+	}
+
+	if (AIController->GetMoveStatus() == EPathFollowingStatus::Idle)
+	{
+		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
+	}
+	else if (Memory->ElapsedTime >= MaxDuration)
+	{
+		AIController->StopMovement();
+		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
+	}
+}
+
+uint16 UBTTask_EnemyMove::GetInstanceMemorySize() const
+{
+	return sizeof(FBTEnemyMoveMemory);
+}
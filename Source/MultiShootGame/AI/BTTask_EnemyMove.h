@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/Tasks/BTTask_BlackboardBase.h"
+#include "BTTask_EnemyMove.generated.h"
+
+struct FBTEnemyMoveMemory
+{
+	float ElapsedTime;
+};
+
+/**
+ * Base for tasks that move the bot to a location chosen relative to the target in BlackboardKey.
+ */
+UCLASS(Abstract)
+class MULTISHOOTGAME_API UBTTask_EnemyMove : public UBTTask_BlackboardBase
+{
+	GENERATED_BODY()
+
+public:
+	UBTTask_EnemyMove();
+
+protected:
+	UPROPERTY(EditAnywhere, Category = Move)
+	float AcceptanceRadius = 50.f;
+
+	UPROPERTY(EditAnywhere, Category = Move)
+	float MaxDuration = 5.f;
+
+	UPROPERTY(EditAnywhere, Category = Move)
+	bool bFocusTarget = true;
+
+	virtual bool FindDestination(APawn* Pawn, AActor* Target, FVector& OutDestination) const
+	PURE_VIRTUAL(UBTTask_EnemyMove::FindDestination, return false;);
+
+	bool ProjectToNavigation(const APawn* Pawn, const FVector& Location, FVector& OutLocation) const;
+
+	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+
+	virtual uint16 GetInstanceMemorySize() const override;
+};
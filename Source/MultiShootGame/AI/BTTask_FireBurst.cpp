@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BTTask_FireBurst.h"
+#include "AIController.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
+
+UBTTask_FireBurst::UBTTask_FireBurst()
+{
+	NodeName = "Fire Burst";
+
+	bNotifyTick = true;
+	bNotifyTaskFinished = true;
+
+	BlackboardKey.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(UBTTask_FireBurst, BlackboardKey),
+	                              AActor::StaticClass());
+}
+
+EBTNodeResult::Type UBTTask_FireBurst::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	FBTFireBurstMemory* Memory = CastInstanceNodeMemory<FBTFireBurstMemory>(NodeMemory);
+	Memory->EnemyCharacter = nullptr;
+
+	AAIController* AIController = OwnerComp.GetAIOwner();
+	AMultiShootGameEnemyCharacter* EnemyCharacter = AIController
+		                                                ? Cast<AMultiShootGameEnemyCharacter>(AIController->GetPawn())
+		                                                : nullptr;
+	AActor* Target = Cast<AActor>(OwnerComp.GetBlackboardComponent()->GetValueAsObject(GetSelectedBlackboardKey()));
+	if (EnemyCharacter == nullptr || Target == nullptr)
+	{
+		return EBTNodeResult::Failed;
+	}
+
+	AIController->SetFocus(Target);
+	EnemyCharacter->StartFire();
+
+	Memory->EnemyCharacter = EnemyCharacter;
+	Memory->RemainingTime = FMath::Max(BurstDuration + FMath::FRandRange(-BurstDeviation, BurstDeviation), 0.1f);
+
+	return EBTNodeResult::InProgress;
+}
+
+EBTNodeResult::Type UBTTask_FireBurst::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	return EBTNodeResult::Aborted;
+}
+
+void UBTTask_FireBurst::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
+	FBTFireBurstMemory* Memory = CastInstanceNodeMemory<FBTFireBurstMemory>(NodeMemory);
+	Memory->RemainingTime -= DeltaSeconds;
+
+	const AAIController* AIController = OwnerComp.GetAIOwner();
+	AMultiShootGameEnemyCharacter* EnemyCharacter = AIController
+		                                                ? Cast<AMultiShootGameEnemyCharacter>(AIController->GetPawn())
+		                                                : nullptr;
+	if (EnemyCharacter == nullptr || EnemyCharacter->GetHealthComponent()->bDied)
+	{
+		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
+		return;
+	}
+
+	if (Memory->RemainingTime <= 0.f)
+	{
+		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
+	}
+}
+
+void UBTTask_FireBurst::OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory,
+                                       EBTNodeResult::Type TaskResult)
+{
+	// The pawn that started firing, even if the controller has been unpossessed since
+	FBTFireBurstMemory* Memory = CastInstanceNodeMemory<FBTFireBurstMemory>(NodeMemory);
+	if (Memory->EnemyCharacter.IsValid())
+	{
+		Memory->EnemyCharacter->StopFire();
+	}
+	Memory->EnemyCharacter = nullptr;
+
+	Super::OnTaskFinished(OwnerComp, NodeMemory, TaskResult);
+}
+
+uint16 UBTTask_FireBurst::GetInstanceMemorySize() const
+{
+	return sizeof(FBTFireBurstMemory);
+}
+
+FString UBTTask_FireBurst::GetStaticDescription() const
+{
+	return FString::Printf(TEXT("%s\nBurst %.2fs +- %.2fs"), *Super::GetStaticDescription(), BurstDuration,
+	                       BurstDeviation);
+}
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/Tasks/BTTask_BlackboardBase.h"
+#include "BTTask_FireBurst.generated.h"
+
+class AMultiShootGameEnemyCharacter;
+
+struct FBTFireBurstMemory
+{
+	float RemainingTime;
+
+	TWeakObjectPtr<AMultiShootGameEnemyCharacter> EnemyCharacter;
+};
+
+/**
+ * Focuses the target in BlackboardKey and holds the trigger for one burst.
+ */
+UCLASS()
+class MULTISHOOTGAME_API UBTTask_FireBurst : public UBTTask_BlackboardBase
+{
+	GENERATED_BODY()
+
+public:
+	UBTTask_FireBurst();
+
+protected:
+	UPROPERTY(EditAnywhere, Category = Fire)
+	float BurstDuration = 1.f;
+
+	UPROPERTY(EditAnywhere, Category = Fire)
+	float BurstDeviation = 0.3f;
+
+	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+
+	/** Releases the trigger on every way out of the task: success, failure and abort. */
+	virtual void OnTaskFinished(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory,
+	                            EBTNodeResult::Type TaskResult) override;
+
+	virtual uint16 GetInstanceMemorySize() const override;
+
+	virtual FString GetStaticDescription() const override;
+};
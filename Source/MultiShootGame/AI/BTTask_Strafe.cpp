@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BTTask_Strafe.h"
+
+UBTTask_Strafe::UBTTask_Strafe()
+{
+	NodeName = "Strafe";
+}
+
+bool UBTTask_Strafe::FindDestination(APawn* Pawn, AActor* Target, FVector& OutDestination) const
+{
+	const FVector Forward = Target
+		                        ? (Target->GetActorLocation() - Pawn->GetActorLocation()).GetSafeNormal2D()
+		                        : Pawn->GetActorForwardVector();
+	const FVector Right = FVector::CrossProduct(FVector::UpVector, Forward);
+	const float Distance = FMath::FRandRange(MinStrafeDistance, MaxStrafeDistance);
+	const float Side = FMath::RandBool() ? 1.f : -1.f;
+
+	// Try the random side first and fall back to the other one when it leaves the navmesh
+	return ProjectToNavigation(Pawn, Pawn->GetActorLocation() + Right * Side * Distance, OutDestination) ||
+		ProjectToNavigation(Pawn, Pawn->GetActorLocation() - Right * Side * Distance, OutDestination);
+}
+
+FString UBTTask_Strafe::GetStaticDescription() const
+{
+	return FString::Printf(TEXT("%s\nStrafe %.0f - %.0f"), *Super::GetStaticDescription(), MinStrafeDistance,
+	                       MaxStrafeDistance);
+}
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BTTask_EnemyMove.h"
+#include "BTTask_Strafe.generated.h"
+
+/**
+ * Moves sideways relative to the target while keeping it in focus.
+ */
+UCLASS()
+class MULTISHOOTGAME_API UBTTask_Strafe : public UBTTask_EnemyMove
+{
+	GENERATED_BODY()
+
+public:
+	UBTTask_Strafe();
+
+protected:
+	UPROPERTY(EditAnywhere, Category = Move)
+	float MinStrafeDistance = 200.f;
+
+	UPROPERTY(EditAnywhere, Category = Move)
+	float MaxStrafeDistance = 500.f;
+
+	virtual bool FindDestination(APawn* Pawn, AActor* Target, FVector& OutDestination) const override;
+
+	virtual FString GetStaticDescription() const override;
+};
@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BTTask_TakeCover.h"
+
+UBTTask_TakeCover::UBTTask_TakeCover()
+{
+	NodeName = "Take Cover";
+}
+
+bool UBTTask_TakeCover::FindDestination(APawn* Pawn, AActor* Target, FVector& OutDestination) const
+{
+	if (Target == nullptr)
+	{
+		return false;
+	}
+
+	const APawn* TargetPawn = Cast<APawn>(Target);
+	const FVector TargetViewLocation = TargetPawn ? TargetPawn->GetPawnViewLocation() : Target->GetActorLocation();
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(EnemyCover), false, Pawn);
+	QueryParams.AddIgnoredActor(Target);
+
+	bool bFound = false;
+	float BestDistanceSquared = MAX_FLT;
+	const float AngleOffset = FMath::FRand() * 2.f * PI;
+	for (int i = 0; i < NumSamples; i++)
+	{
+		const float Angle = AngleOffset + 2.f * PI * i / NumSamples;
+		const float Radius = CoverSearchRadius * (i % 2 == 0 ? 0.5f : 1.f);
+		const FVector Sample = Pawn->GetActorLocation() + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0) * Radius;
+
+		FVector CoverLocation;
+		if (!ProjectToNavigation(Pawn, Sample, CoverLocation))
+		{
+			continue;
+		}
+
+		const float DistanceSquared = FVector::DistSquared(Pawn->GetActorLocation(), CoverLocation);
+		if (DistanceSquared >= BestDistanceSquared)
+		{
+			continue;
+		}
+
+		if (Pawn->GetWorld()->LineTraceTestByChannel(TargetViewLocation, CoverLocation + FVector(0, 0, CoverHeight),
+		                                            ECC_Visibility, QueryParams))
+		{
+			bFound = true;
+			BestDistanceSquared = DistanceSquared;
+			OutDestination = CoverLocation;
+		}
+	}
+
+	return bFound;
+}
+
+FString UBTTask_TakeCover::GetStaticDescription() const
+{
+	return FString::Printf(TEXT("%s\nCover within %.0f"), *Super::GetStaticDescription(), CoverSearchRadius);
+}
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BTTask_EnemyMove.h"
+#include "BTTask_TakeCover.generated.h"
+
+/**
+ * Samples points around the bot and moves to the closest one the target cannot see.
+ */
+UCLASS()
+class MULTISHOOTGAME_API UBTTask_TakeCover : public UBTTask_EnemyMove
+{
+	GENERATED_BODY()
+
+public:
+	UBTTask_TakeCover();
+
+protected:
+	UPROPERTY(EditAnywhere, Category = Move)
+	float CoverSearchRadius = 1000.f;
+
+	UPROPERTY(EditAnywhere, Category = Move)
+	int NumSamples = 12;
+
+	UPROPERTY(EditAnywhere, Category = Move)
+	float CoverHeight = 60.f;
+
+	virtual bool FindDestination(APawn* Pawn, AActor* Target, FVector& OutDestination) const override;
+
+	virtual FString GetStaticDescription() const override;
+};
@@ -3,20 +3,26 @@
 
 #include "MiniMapCamera.h"
 
+#include "PickupActor.h"
 #include "Components/SceneCaptureComponent2D.h"
+#include "WorldCollision.h"
 #include "Kismet/GameplayStatics.h"
+#include "MultiShootGame/Component/HealthComponent.h"
 
 // Sets default values
 AMiniMapCamera::AMiniMapCamera()
 {
-	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+	// Only ticks when capturing every frame, throttled captures follow the player from a timer instead
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	SceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("SceneComponent"));
 	RootComponent = SceneComponent;
 
 	MinimapCameraComponent2D = CreateDefaultSubobject<USceneCaptureComponent2D>(TEXT("MinimapCameraComponent2D"));
 	MinimapCameraComponent2D->SetupAttachment(SceneComponent);
+	MinimapCameraComponent2D->bCaptureEveryFrame = false;
+	MinimapCameraComponent2D->bCaptureOnMovement = false;
 }
 
 // Called when the game starts or when spawned
@@ -25,6 +31,25 @@ void AMiniMapCamera::BeginPlay()
 	Super::BeginPlay();
 
 	MinimapCameraComponent2D->HiddenActors.Add(UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
+
+	MinimapCameraComponent2D->bCaptureEveryFrame = false;
+	MinimapCameraComponent2D->bCaptureOnMovement = false;
+
+	if (MinimapMode == EMinimapMode::BakedTiles || GetNetMode() == NM_DedicatedServer)
+	{
+		MinimapCameraComponent2D->Deactivate();
+		return;
+	}
+
+	if (CaptureFrequency <= 0.f)
+	{
+		MinimapCameraComponent2D->bCaptureEveryFrame = true;
+		SetActorTickEnabled(true);
+		return;
+	}
+
+	GetWorldTimerManager().SetTimer(CaptureTimerHandle, this, &AMiniMapCamera::UpdateCapture, 1.f / CaptureFrequency,
+	                                true, 0.f);
 }
 
 // Called every frame
@@ -32,17 +57,117 @@ void AMiniMapCamera::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	UpdateCameraTransform();
+}
+
+void AMiniMapCamera::UpdateCameraTransform()
+{
+	APawn* PlayerPawn = GetViewPawn();
 
 	if (PlayerPawn) {
-		FVector Position = PlayerPawn->GetActorLocation();
-		Position += FVector(0, 0, CameraHeight);
+		SetActorLocationAndRotation(GetMapCenter() + FVector(0, 0, CameraHeight), FRotator(0, GetMapYaw(), 0));
+	}
+}
+
+void AMiniMapCamera::UpdateCapture()
+{
+	UpdateCameraTransform();
+
+	MinimapCameraComponent2D->CaptureScene();
+}
+
+APawn* AMiniMapCamera::GetViewPawn() const
+{
+	return UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+}
+
+FVector AMiniMapCamera::GetMapCenter() const
+{
+	const APawn* PlayerPawn = GetViewPawn();
+
+	return PlayerPawn ? PlayerPawn->GetActorLocation() : GetActorLocation();
+}
+
+float AMiniMapCamera::GetMapYaw() const
+{
+	const APawn* PlayerPawn = GetViewPawn();
+
+	return PlayerPawn ? PlayerPawn->GetControlRotation().Yaw : GetActorRotation().Yaw;
+}
+
+FVector2D AMiniMapCamera::WorldToMap(FVector WorldLocation) const
+{
+	FVector Offset = WorldLocation - GetMapCenter();
+	Offset.Z = 0.f;
+
+	// X forward and Y right in the player's view, forward is the top of the map
+	const FVector ViewOffset = FRotator(0, -GetMapYaw(), 0).RotateVector(Offset);
+
+	return FVector2D(ViewOffset.Y, -ViewOffset.X) / MapWorldRadius;
+}
+
+void AMiniMapCamera::GetMinimapIcons(TArray<FMinimapIcon>& OutIcons) const
+{
+	OutIcons.Reset();
+
+	const APawn* PlayerPawn = GetViewPawn();
+	if (PlayerPawn == nullptr)
+	{
+		return;
+	}
+
+	FCollisionObjectQueryParams ObjectQueryParams;
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_Pawn);
+	ObjectQueryParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	TArray<FOverlapResult> Overlaps;
+	GetWorld()->OverlapMultiByObjectType(Overlaps, PlayerPawn->GetActorLocation(), FQuat::Identity, ObjectQueryParams,
+	                                     FCollisionShape::MakeSphere(MapWorldRadius));
+
+	const float MapYaw = GetMapYaw();
+
+	// An actor shows up once per overlapping component
+	TSet<const AActor*> AddedActors;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		AActor* Actor = Overlap.GetActor();
+		if (Actor == nullptr || AddedActors.Contains(Actor))
+		{
+			continue;
+		}
+
+		EMinimapIconType IconType;
+		if (Actor == PlayerPawn)
+		{
+			IconType = EMinimapIconType::Self;
+		}
+		else if (Cast<APickupActor>(Actor))
+		{
+			IconType = EMinimapIconType::Pickup;
+		}
+		else if (Cast<APawn>(Actor))
+		{
+			const UHealthComponent* HealthComponent = UHealthComponent::FindHealthComponent(Actor);
+			if (HealthComponent && HealthComponent->bDied)
+			{
+				continue;
+			}
+
+			IconType = UHealthComponent::GetTeamAttitude(PlayerPawn, Actor) == ETeamAttitude::Hostile
+				           ? EMinimapIconType::Hostile
+				           : EMinimapIconType::Friendly;
+		}
+		else
+		{
+			continue;
+		}
 
-		FRotator Rotation = PlayerPawn->GetControlRotation();
-		Rotation = FRotator(0, Rotation.Yaw, 0);
+		AddedActors.Add(Actor);
 
-		SetActorLocation(Position);
-		SetActorRotation(Rotation);
+		FMinimapIcon& Icon = OutIcons.AddDefaulted_GetRef();
+		Icon.Actor = Actor;
+		Icon.IconType = IconType;
+		Icon.Position = WorldToMap(Actor->GetActorLocation());
+		Icon.Yaw = FRotator::NormalizeAxis(Actor->GetActorRotation().Yaw - MapYaw);
 	}
-	
 }
@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "MultiShootGame/DataAsset/MinimapTileSet.h"
+#include "MultiShootGame/Enum/EMinimapMode.h"
+#include "MultiShootGame/Struct/MinimapIcon.h"
 #include "MiniMapCamera.generated.h"
 
 UCLASS()
@@ -28,7 +31,54 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = MinimapCamera)
 	float CameraHeight = 1000.f;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = MinimapCamera)
+	EMinimapMode MinimapMode = EMinimapMode::SceneCapture;
+
+	/**
+	 * Captures per second in the capture modes, 0 captures every frame. Dynamic geometry over baked tiles rarely
+	 * needs more than a few.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = MinimapCamera, meta = (ClampMin = 0.0f))
+	float CaptureFrequency = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = MinimapCamera)
+	UMinimapTileSet* TileSet;
+
+	/** Distance from the map center to its edge, also the icon query radius. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = MinimapCamera, meta = (ClampMin = 1.0f))
+	float MapWorldRadius = 2500.f;
+
+	FTimerHandle CaptureTimerHandle;
+
+	void UpdateCameraTransform();
+
+	void UpdateCapture();
+
 public:
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
+
+	UFUNCTION(BlueprintPure, Category = MinimapCamera)
+	APawn* GetViewPawn() const;
+
+	UFUNCTION(BlueprintPure, Category = MinimapCamera)
+	FVector GetMapCenter() const;
+
+	/** The map turns with the player, so this is the view yaw at the top of the map. */
+	UFUNCTION(BlueprintPure, Category = MinimapCamera)
+	float GetMapYaw() const;
+
+	/** Map space position of a world location, see FMinimapIcon::Position. */
+	UFUNCTION(BlueprintPure, Category = MinimapCamera)
+	FVector2D WorldToMap(FVector WorldLocation) const;
+
+	/** Players, enemies and pickups within MapWorldRadius, found with one overlap query. */
+	UFUNCTION(BlueprintCallable, Category = MinimapCamera)
+	void GetMinimapIcons(TArray<FMinimapIcon>& OutIcons) const;
+
+	UFUNCTION(BlueprintPure, Category = MinimapCamera)
+	FORCEINLINE EMinimapMode GetMinimapMode() const { return MinimapMode; }
+
+	UFUNCTION(BlueprintPure, Category = MinimapCamera)
+	FORCEINLINE UMinimapTileSet* GetTileSet() const { return TileSet; }
 };
@@ -5,6 +5,7 @@
 
 #include "Kismet/GameplayStatics.h"
 #include "MultiShootGame/Character/MultiShootGameCharacter.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
 
 // Sets default values
 APickupActor::APickupActor()
@@ -55,6 +56,11 @@ void APickupActor::NotifyActorBeginOverlap(AActor* OtherActor)
 {
 	Super::NotifyActorBeginOverlap(OtherActor);
 
+	if (MatchInstanceId != INDEX_NONE && AMultiShootGamePlayerState::FindMatchInstanceId(OtherActor) != MatchInstanceId)
+	{
+		return;
+	}
+
 	if (Cast<AMultiShootGameCharacter>(OtherActor) && bRespawn)
 	{
 		PowerupInstance->ActivatedPowerUp(OtherActor);
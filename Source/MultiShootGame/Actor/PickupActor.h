@@ -43,6 +43,10 @@ protected:
 	UPROPERTY(EditInstanceOnly, Category = PickupActor)
 	float RespawnBoolDuration = 2.0f;
 
+	/** Hosted match that may pick this up, or -1 for every match. */
+	UPROPERTY(EditInstanceOnly, Category = PickupActor)
+	int MatchInstanceId = INDEX_NONE;
+
 	FTimerHandle TimerHandle_RespawnTimer;
 
 	FTimerHandle TimerHandle_RespawnBoolTimer;
@@ -14,6 +14,10 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "MultiShootGame/GameMode/MultiShootGameGameMode.h"
 #include "MultiShootGame/Gamemode/MultiShootGamePlayerState.h"
+#include "MultiShootGame/GameMode/MultiShootGameMatchInstance.h"
+#include "MultiShootGame/Subsystem/AnimationBudgetSubsystem.h"
+#include "MultiShootGame/Subsystem/CombatLogSubsystem.h"
+#include "MultiShootGame/Subsystem/ImpactEventSubsystem.h"
 #include "MultiShootGame/GameMode/MultiShootGameServerGameState.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Net/UnrealNetwork.h"
@@ -151,6 +155,23 @@ void AMultiShootGameCharacter::BeginPlay()
 		                                    FAttachmentTransformRules::SnapToTargetIncludingScale);
 		CurrentFPSCamera->SetActorHiddenInGame(true);
 	}
+
+	// The loadout actors finished BeginPlay while being spawned above, before they were assigned
+	TryInitializeLoadout();
+}
+
+void AMultiShootGameCharacter::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+
+	TryInitializeLoadout();
+}
+
+void AMultiShootGameCharacter::OnRep_PlayerState()
+{
+	Super::OnRep_PlayerState();
+
+	TryInitializeLoadout();
 }
 
 void AMultiShootGameCharacter::Destroyed()
@@ -339,6 +360,7 @@ void AMultiShootGameCharacter::BeginAim()
 
 	APlayerController* PlayerController = Cast<APlayerController>(GetController());
 	PlayerController->SetViewTargetWithBlend(CurrentFPSCamera, 0.1f);
+	CurrentFPSCamera->SetViewActive(true);
 
 	CurrentMainWeapon->SetActorHiddenInGame(true);
 	CurrentSecondWeapon->SetActorHiddenInGame(true);
@@ -376,6 +398,7 @@ void AMultiShootGameCharacter::EndAim()
 	PlayerController->SetViewTargetWithBlend(this, 0.1f);
 
 	CurrentFPSCamera->SetActorHiddenInGame(true);
+	CurrentFPSCamera->SetViewActive(false);
 	CurrentMainWeapon->SetActorHiddenInGame(false);
 	CurrentSecondWeapon->SetActorHiddenInGame(false);
 	CurrentThirdWeapon->SetActorHiddenInGame(false);
@@ -404,38 +427,41 @@ void AMultiShootGameCharacter::Fire_Server_Implementation(FWeaponInfo WeaponInfo
 		CurrentProjectile->ProjectileInitialize(WeaponInfo.BaseDamage);
 	}
 
+	UCombatLogSubsystem::Record(this, ECombatEventType::Shot, this, nullptr, WeaponInfo.BaseDamage);
+
 	Fire_Multicast(WeaponInfo, MuzzleSocketName);
 }
 
 void AMultiShootGameCharacter::Fire_Multicast_Implementation(FWeaponInfo WeaponInfo, FName MuzzleSocketName)
 {
-	USkeletalMeshComponent* WeaponMeshComponent = nullptr;
+	AMultiShootGameWeapon* CurrentWeapon = nullptr;
 
 	switch (WeaponMode)
 	{
 	case EWeaponMode::MainWeapon:
-		WeaponMeshComponent = CurrentMainWeapon->GetWeaponMeshComponent();
+		CurrentWeapon = CurrentMainWeapon;
 		break;
 	case EWeaponMode::SecondWeapon:
-		WeaponMeshComponent = CurrentSecondWeapon->GetWeaponMeshComponent();
+		CurrentWeapon = CurrentSecondWeapon;
 		break;
 	case EWeaponMode::ThirdWeapon:
-		WeaponMeshComponent = CurrentThirdWeapon->GetWeaponMeshComponent();
+		CurrentWeapon = CurrentThirdWeapon;
 		break;
 	}
 
-	if (WeaponInfo.FireSoundCue)
+	if (CurrentWeapon == nullptr)
 	{
-		UGameplayStatics::PlaySoundAtLocation(GetWorld(), WeaponInfo.FireSoundCue,
-		                                      WeaponMeshComponent->GetSocketLocation(MuzzleSocketName));
+		return;
 	}
 
-	if (WeaponInfo.MuzzleEffect)
+	CurrentWeapon->GetWeaponAudioComponent()->PlayFireSound(WeaponInfo.FireSoundCue, WeaponInfo.FireLoopSoundCue,
+	                                                        WeaponInfo.FireTailSoundCue,
+	                                                        WeaponInfo.FireSoundConcurrency);
+
+	if (bAimed && !IsLocallyControlled() || !bAimed)
 	{
-		if (bAimed && !IsLocallyControlled() || !bAimed)
-		{
-			UGameplayStatics::SpawnEmitterAttached(WeaponInfo.MuzzleEffect, WeaponMeshComponent, MuzzleSocketName);
-		}
+		CurrentWeapon->GetMuzzleFlashComponent()->PlayMuzzleFlash(WeaponInfo.MuzzleEffect,
+		                                                          WeaponInfo.MuzzleBurstEffect);
 	}
 }
 
@@ -665,6 +691,14 @@ void AMultiShootGameCharacter::KnifeHit_Server_Implementation()
 
 		const FVector HitLocation = KnifeSkeletalMeshComponent->GetSocketLocation(HitSocketName);
 		const FRotator HitRotation = KnifeSkeletalMeshComponent->GetComponentRotation();
+
+		const UAnimationBudgetSubsystem* AnimationBudgetSubsystem = GetWorld()->GetSubsystem<
+			UAnimationBudgetSubsystem>();
+		if (AnimationBudgetSubsystem)
+		{
+			AnimationBudgetSubsystem->RefreshBonesForHitValidation(HitLocation, KnifeBoneRefreshRadius);
+		}
+
 		FHitResult HitResult;
 		TArray<AActor*> IgnoreActors;
 		IgnoreActors.Add(this);
@@ -673,10 +707,24 @@ void AMultiShootGameCharacter::KnifeHit_Server_Implementation()
 		{
 			const EPhysicalSurface SurfaceType = UPhysicalMaterial::DetermineSurfaceType(HitResult.PhysMaterial.Get());
 
-			UGameplayStatics::ApplyDamage(HitResult.GetActor(), KnifeDamage, GetInstigatorController(), this,
+			bool bHeadShot = false;
+			const float Damage = KnifeDamage * UHealthComponent::GetHitZoneMultiplier(
+				HitResult.GetActor(), HitResult.GetComponent(), HitResult.Item, bHeadShot);
+
+			if (bHeadShot)
+			{
+				UHealthComponent* TargetHealthComponent = UHealthComponent::FindHealthComponent(HitResult.GetActor());
+				if (TargetHealthComponent)
+				{
+					TargetHealthComponent->NotifyHeadShot(this);
+				}
+			}
+
+			UGameplayStatics::ApplyDamage(HitResult.GetActor(), Damage, GetInstigatorController(), this,
 			                              DamageTypeClass);
 
-			HitEffectComponent->PlayHitEffect(SurfaceType, HitLocation, HitRotation);
+			UImpactEventSubsystem::RecordImpact(this, HitLocation, HitResult.ImpactNormal, HitRotation.Vector(),
+			                                    SurfaceType, false);
 		}
 	}
 }
@@ -892,6 +940,7 @@ void AMultiShootGameCharacter::ToggleFirstPersonView()
 
 	APlayerController* PlayerController = Cast<APlayerController>(GetController());
 	PlayerController->SetViewTargetWithBlend(CurrentFPSCamera, 0.1f);
+	CurrentFPSCamera->SetViewActive(true);
 
 	CurrentFPSCamera->SetActorHiddenInGame(false);
 	CurrentMainWeapon->SetActorHiddenInGame(true);
@@ -924,6 +973,7 @@ void AMultiShootGameCharacter::ToggleThirdPersonView()
 	PlayerController->SetViewTargetWithBlend(this, 0.1f);
 
 	CurrentFPSCamera->SetActorHiddenInGame(true);
+	CurrentFPSCamera->SetViewActive(false);
 	CurrentMainWeapon->SetActorHiddenInGame(false);
 	CurrentSecondWeapon->SetActorHiddenInGame(false);
 	CurrentThirdWeapon->SetActorHiddenInGame(false);
@@ -965,13 +1015,31 @@ void AMultiShootGameCharacter::HeadShot(AActor* DamageCauser)
 
 void AMultiShootGameCharacter::Reborn_Server_Implementation()
 {
-	TArray<AActor*> OutActorArray;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), PlayerStartClass, OutActorArray);
-	const AActor* OutActor = OutActorArray[UKismetMathLibrary::RandomInteger(OutActorArray.Max())];
+	const AMultiShootGamePlayerState* TempPlayerState = GetPlayerState<AMultiShootGamePlayerState>();
+
+	const AActor* OutActor;
+	if (TempPlayerState && TempPlayerState->GetMatchInstanceId() != INDEX_NONE && CurrentGameMode)
+	{
+		// Hosted matches respawn inside their own area
+		OutActor = CurrentGameMode->ChoosePlayerStart(GetController());
+	}
+	else
+	{
+		TArray<AActor*> OutActorArray;
+		UGameplayStatics::GetAllActorsOfClass(GetWorld(), PlayerStartClass, OutActorArray);
+		OutActor = OutActorArray[UKismetMathLibrary::RandomInteger(OutActorArray.Max())];
+	}
 	const FTransform Transform = OutActor->GetActorTransform();
 
 	AMultiShootGameCharacter* Character = GetWorld()->SpawnActor<AMultiShootGameCharacter>(CharacterClass, Transform);
-	GetController()->Possess(Character);
+	AController* CurrentController = GetController();
+	CurrentController->Possess(Character);
+
+	AMultiShootGameGameMode* MultiShootGameMode = Cast<AMultiShootGameGameMode>(CurrentGameMode);
+	if (MultiShootGameMode)
+	{
+		MultiShootGameMode->OnPlayerAlive(CurrentController);
+	}
 
 	Destroy();
 }
@@ -1097,41 +1165,51 @@ void AMultiShootGameCharacter::CheckShowSight(float DeltaSeconds)
 	}
 }
 
-void AMultiShootGameCharacter::CheckWeaponInitialized()
+void AMultiShootGameCharacter::TryInitializeLoadout()
 {
-	if (CurrentMainWeapon && CurrentMainWeapon->bInitializeReady &&
-		CurrentSecondWeapon && CurrentSecondWeapon->bInitializeReady &&
-		CurrentThirdWeapon && CurrentThirdWeapon->bInitializeReady &&
-		CurrentFPSCamera && CurrentFPSCamera->bInitializeReady &&
-		GetPlayerState() && IsLocallyControlled())
+	if (bLoadoutReady || !IsLocallyControlled())
 	{
-		AMultiShootGamePlayerState* TempPlayerState = Cast<AMultiShootGamePlayerState>(GetPlayerState());
-		TempPlayerState->SetMainWeaponMesh_Server(CurrentMainWeapon->WeaponInfo.WeaponMesh);
-		TempPlayerState->SetSecondWeaponMesh_Server(CurrentSecondWeapon->WeaponInfo.WeaponMesh);
-		TempPlayerState->SetThirdWeaponMesh_Server(CurrentThirdWeapon->WeaponInfo.WeaponMesh);
+		return;
+	}
 
-		HandleWeaponMesh_Server();
+	if (!CurrentMainWeapon || !CurrentMainWeapon->bInitializeReady ||
+		!CurrentSecondWeapon || !CurrentSecondWeapon->bInitializeReady ||
+		!CurrentThirdWeapon || !CurrentThirdWeapon->bInitializeReady ||
+		!CurrentFPSCamera || !CurrentFPSCamera->bInitializeReady)
+	{
+		return;
+	}
 
-		FWeaponInfo WeaponInfo;
-		switch (GetWeaponMode())
-		{
-		case EWeaponMode::MainWeapon:
-			WeaponInfo = CurrentMainWeapon->WeaponInfo;
-			break;
-		case EWeaponMode::SecondWeapon:
-			WeaponInfo = CurrentSecondWeapon->WeaponInfo;
-			break;
-		case EWeaponMode::ThirdWeapon:
-			WeaponInfo = CurrentThirdWeapon->WeaponInfo;
-			break;
-		}
-		CurrentFPSCamera->SetWeaponInfo(WeaponInfo);
+	AMultiShootGamePlayerState* TempPlayerState = GetPlayerState<AMultiShootGamePlayerState>();
+	if (TempPlayerState == nullptr)
+	{
+		return;
+	}
+
+	bLoadoutReady = true;
 
-		CurrentMainWeapon->bInitializeReady = false;
-		CurrentSecondWeapon->bInitializeReady = false;
-		CurrentThirdWeapon->bInitializeReady = false;
-		CurrentFPSCamera->bInitializeReady = false;
+	TempPlayerState->SetMainWeaponMesh_Server(CurrentMainWeapon->WeaponInfo.WeaponMesh);
+	TempPlayerState->SetSecondWeaponMesh_Server(CurrentSecondWeapon->WeaponInfo.WeaponMesh);
+	TempPlayerState->SetThirdWeaponMesh_Server(CurrentThirdWeapon->WeaponInfo.WeaponMesh);
+
+	HandleWeaponMesh_Server();
+
+	FWeaponInfo WeaponInfo;
+	switch (GetWeaponMode())
+	{
+	case EWeaponMode::MainWeapon:
+		WeaponInfo = CurrentMainWeapon->WeaponInfo;
+		break;
+	case EWeaponMode::SecondWeapon:
+		WeaponInfo = CurrentSecondWeapon->WeaponInfo;
+		break;
+	case EWeaponMode::ThirdWeapon:
+		WeaponInfo = CurrentThirdWeapon->WeaponInfo;
+		break;
 	}
+	CurrentFPSCamera->SetWeaponInfo(WeaponInfo);
+
+	OnLoadoutReady.Broadcast(this);
 }
 
 void AMultiShootGameCharacter::SetWalkSpeed_Server_Implementation(float Value)
@@ -1254,6 +1332,14 @@ void AMultiShootGameCharacter::Death_Server_Implementation()
 {
 	HealthComponent->bDied = true;
 
+	UCombatLogSubsystem::Record(this, ECombatEventType::Death, nullptr, this);
+
+	AMultiShootGameGameMode* MultiShootGameMode = Cast<AMultiShootGameGameMode>(CurrentGameMode);
+	if (MultiShootGameMode)
+	{
+		MultiShootGameMode->OnPlayerDied(GetController());
+	}
+
 	Death_Multicast();
 }
 
@@ -1268,6 +1354,7 @@ void AMultiShootGameCharacter::Death_Multicast_Implementation()
 	PlayerController->SetViewTargetWithBlend(this, 0.1f);
 
 	CurrentFPSCamera->SetActorHiddenInGame(true);
+	CurrentFPSCamera->SetViewActive(false);
 	CurrentMainWeapon->SetActorHiddenInGame(false);
 	CurrentSecondWeapon->SetActorHiddenInGame(false);
 	CurrentThirdWeapon->SetActorHiddenInGame(false);
@@ -1310,7 +1397,7 @@ void AMultiShootGameCharacter::OnHealthChanged(UHealthComponent* OwningHealthCom
 		AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(DamageCauser);
 		if (Character)
 		{
-			Character->OnEnemyKilled();
+			Character->OnEnemyKilled(this);
 		}
 		Death_Server();
 	}
@@ -1318,6 +1405,8 @@ void AMultiShootGameCharacter::OnHealthChanged(UHealthComponent* OwningHealthCom
 
 void AMultiShootGameCharacter::Tick(float DeltaTime)
 {
+	const double TickStartTime = FPlatformTime::Seconds();
+
 	Super::Tick(DeltaTime);
 
 	bMoving = GetCharacterMovement()->Velocity.Size() > 0;
@@ -1342,8 +1431,33 @@ void AMultiShootGameCharacter::Tick(float DeltaTime)
 		FPSCameraSceneComponent->SetWorldRotation(TargetRotation);
 	}
 
-	CheckWeaponInitialized();
+	if (CurrentFPSCamera && IsLocallyControlled())
+	{
+		CurrentFPSCamera->SetViewState(GetCharacterMovement()->Velocity.Size(), bFired, bAimed, bReloading,
+		                               bToggleWeapon);
+	}
+
 	CheckShowSight(DeltaTime);
+
+	if (GetLocalRole() == ROLE_Authority)
+	{
+		const AMultiShootGamePlayerState* TempPlayerState = GetPlayerState<AMultiShootGamePlayerState>();
+		if (TempPlayerState && TempPlayerState->GetMatchInstance())
+		{
+			TempPlayerState->GetMatchInstance()->AddFrameTime(FPlatformTime::Seconds() - TickStartTime);
+		}
+	}
+}
+
+bool AMultiShootGameCharacter::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+                                                const FVector& SrcLocation) const
+{
+	if (!AMultiShootGamePlayerState::IsSameMatch(this, RealViewer))
+	{
+		return false;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
 }
 
 void AMultiShootGameCharacter::SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent)
@@ -1427,8 +1541,10 @@ void AMultiShootGameCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProper
 	DOREPLIFETIME(AMultiShootGameCharacter, bToggleView);
 }
 
-void AMultiShootGameCharacter::OnEnemyKilled()
+void AMultiShootGameCharacter::OnEnemyKilled(AActor* KilledActor)
 {
+	UCombatLogSubsystem::Record(this, ECombatEventType::Kill, this, KilledActor);
+
 	AMultiShootGamePlayerState* CurrentPlayerState = Cast<AMultiShootGamePlayerState>(GetPlayerState());
 	if (CurrentPlayerState)
 	{
@@ -1439,6 +1555,20 @@ void AMultiShootGameCharacter::OnEnemyKilled()
 	CurrentShowSight = 0.f;
 }
 
+void AMultiShootGameCharacter::ImpactEvents_Client_Implementation(const TArray<FImpactEvent>& ImpactEvents)
+{
+	const UImpactEventSubsystem* ImpactEventSubsystem = GetWorld()->GetSubsystem<UImpactEventSubsystem>();
+	if (ImpactEventSubsystem == nullptr)
+	{
+		return;
+	}
+
+	for (const FImpactEvent& ImpactEvent : ImpactEvents)
+	{
+		ImpactEventSubsystem->PlayImpactEvent(ImpactEvent);
+	}
+}
+
 void AMultiShootGameCharacter::OnHeadshot()
 {
 	AMultiShootGamePlayerState* CurrentPlayerState = Cast<AMultiShootGamePlayerState>(GetPlayerState());
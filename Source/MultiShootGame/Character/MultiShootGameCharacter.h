@@ -9,13 +9,19 @@
 #include "MultiShootGame/Enum//EWeaponMode.h"
 #include "MultiShootGame/Component/HealthComponent.h"
 #include "MultiShootGame/Component//HitEffectComponent.h"
+#include "MultiShootGame/Interface/MultiShootGameImpactSource.h"
+#include "MultiShootGame/Struct/ImpactEvent.h"
 #include "MultiShootGame/Weapon/MultiShootGameGrenade.h"
 #include "MultiShootGame/Weapon/MultiShootGameFPSCamera.h"
 #include "MultiShootGame/Weapon/MultiShootGameWeapon.h"
 #include "MultiShootGameCharacter.generated.h"
 
+class AMultiShootGameCharacter;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLoadoutReadySignature, AMultiShootGameCharacter*);
+
 UCLASS(config=Game)
-class AMultiShootGameCharacter : public ACharacter
+class AMultiShootGameCharacter : public ACharacter, public IMultiShootGameImpactSource
 {
 	GENERATED_BODY()
 
@@ -29,6 +35,10 @@ protected:
 
 	virtual void Destroyed() override;
 
+	virtual void PossessedBy(AController* NewController) override;
+
+	virtual void OnRep_PlayerState() override;
+
 	UFUNCTION(BlueprintCallable)
 	void StartFire();
 
@@ -286,6 +296,9 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Character)
 	float KnifeDamage = 100.f;
 
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Character)
+	float KnifeBoneRefreshRadius = 200.f;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Character)
 	float GrenadeDamage = 150.f;
 
@@ -374,7 +387,7 @@ protected:
 
 	void CheckShowSight(float DeltaSeconds);
 
-	void CheckWeaponInitialized();
+	bool bLoadoutReady = false;
 
 	float CurrentShowSight = 0.f;
 
@@ -463,7 +476,22 @@ public:
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
-	void OnEnemyKilled();
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+	                              const FVector& SrcLocation) const override;
+
+	void OnEnemyKilled(AActor* KilledActor);
+
+	/** Completes the loadout once every weapon, the FPS camera and the PlayerState are ready. Safe to call often. */
+	void TryInitializeLoadout();
+
+	/** Fired once on the owning client when the loadout is initialized. */
+	FOnLoadoutReadySignature OnLoadoutReady;
+
+	/** Impacts the server batched this frame that are relevant to this player. */
+	UFUNCTION(Client, Unreliable)
+	void ImpactEvents_Client(const TArray<FImpactEvent>& ImpactEvents);
+
+	virtual const UHitEffectComponent* GetImpactHitEffect() const override { return HitEffectComponent; }
 
 	void OnHeadshot();
 
@@ -3,11 +3,23 @@
 
 #include "MultiShootGameEnemyCharacter.h"
 #include "MultiShootGameCharacter.h"
+#include "AIController.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
 #include "Components/AudioComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "MultiShootGame/MultiShootGame.h"
 #include "MultiShootGame/GameMode/MultiShootGameGameMode.h"
+#include "MultiShootGame/GameMode/MultiShootGameMatchInstance.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
+#include "BrainComponent.h"
+#include "MultiShootGame/Subsystem/AnimationBudgetSubsystem.h"
+#include "MultiShootGame/Subsystem/EnemyPerceptionSubsystem.h"
+#include "MultiShootGame/Subsystem/EnemyProxySubsystem.h"
+#include "MultiShootGame/Subsystem/FlowFieldSubsystem.h"
+#include "Perception/AISense_Sight.h"
 
 // Sets default values
 AMultiShootGameEnemyCharacter::AMultiShootGameEnemyCharacter()
@@ -29,6 +41,8 @@ AMultiShootGameEnemyCharacter::AMultiShootGameEnemyCharacter()
 	HealthComponent = CreateDefaultSubobject<UHealthComponent>(TEXT("HealthComponent"));
 
 	AIPerceptionComponent = CreateDefaultSubobject<UAIPerceptionComponent>(TEXT("AIPerceptionComponent"));
+
+	GetMesh()->bEnableUpdateRateOptimizations = true;
 }
 
 // Called when the game starts or when spawned
@@ -41,6 +55,33 @@ void AMultiShootGameEnemyCharacter::BeginPlay()
 	HealthComponent->OnHealthChanged.AddDynamic(this, &AMultiShootGameEnemyCharacter::OnHealthChanged);
 	HealthComponent->OnHeadShot.AddDynamic(this, &AMultiShootGameEnemyCharacter::OnHeadShot);
 
+	if (bUseSharedPerception && GetLocalRole() == ROLE_Authority)
+	{
+		UEnemyPerceptionSubsystem* EnemyPerceptionSubsystem = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>();
+		if (EnemyPerceptionSubsystem)
+		{
+			EnemyPerceptionSubsystem->RegisterBot(this);
+
+			// Sight comes from the shared service, the component keeps any other configured senses
+			AIPerceptionComponent->SetSenseEnabled(UAISense_Sight::StaticClass(), false);
+		}
+	}
+
+	UAnimationBudgetSubsystem* AnimationBudgetSubsystem = GetWorld()->GetSubsystem<UAnimationBudgetSubsystem>();
+	if (AnimationBudgetSubsystem)
+	{
+		AnimationBudgetSubsystem->RegisterEnemy(this);
+	}
+
+	if (GetLocalRole() == ROLE_Authority)
+	{
+		UEnemyProxySubsystem* EnemyProxySubsystem = GetWorld()->GetSubsystem<UEnemyProxySubsystem>();
+		if (EnemyProxySubsystem)
+		{
+			EnemyProxySubsystem->RegisterEnemy(this);
+		}
+	}
+
 	FActorSpawnParameters SpawnParameters;
 	SpawnParameters.Owner = this;
 	SpawnParameters.Instigator = GetInstigator();
@@ -55,10 +96,52 @@ void AMultiShootGameEnemyCharacter::BeginPlay()
 	}
 }
 
+void AMultiShootGameEnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UEnemyPerceptionSubsystem* EnemyPerceptionSubsystem = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>();
+	if (EnemyPerceptionSubsystem)
+	{
+		EnemyPerceptionSubsystem->UnregisterBot(this);
+	}
+
+	UEnemyProxySubsystem* EnemyProxySubsystem = GetWorld()->GetSubsystem<UEnemyProxySubsystem>();
+	if (EnemyProxySubsystem)
+	{
+		EnemyProxySubsystem->UnregisterEnemy(this);
+	}
+
+	UAnimationBudgetSubsystem* AnimationBudgetSubsystem = GetWorld()->GetSubsystem<UAnimationBudgetSubsystem>();
+	if (AnimationBudgetSubsystem)
+	{
+		AnimationBudgetSubsystem->UnregisterEnemy(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMultiShootGameEnemyCharacter::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+
+	// Engine perception and EQS resolve affiliation through the same team table as damage and targeting
+	AAIController* AIController = Cast<AAIController>(NewController);
+	if (AIController)
+	{
+		AIController->SetGenericTeamId(FGenericTeamId(HealthComponent->TeamNumber));
+	}
+}
+
 // Called every frame
 void AMultiShootGameEnemyCharacter::Tick(float DeltaTime)
 {
+	const double TickStartTime = FPlatformTime::Seconds();
+
 	Super::Tick(DeltaTime);
+
+	if (MatchInstance.IsValid())
+	{
+		MatchInstance->AddFrameTime(FPlatformTime::Seconds() - TickStartTime);
+	}
 }
 
 // Called to bind functionality to input
@@ -90,6 +173,23 @@ FVector AMultiShootGameEnemyCharacter::GetPawnViewLocation() const
 	return Super::GetPawnViewLocation();
 }
 
+bool AMultiShootGameEnemyCharacter::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+                                                     const FVector& SrcLocation) const
+{
+	if (!AMultiShootGamePlayerState::IsSameMatch(this, RealViewer))
+	{
+		return false;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
+
+void AMultiShootGameEnemyCharacter::SetMatchInstance(AMultiShootGameMatchInstance* NewMatchInstance)
+{
+	MatchInstance = NewMatchInstance;
+	MatchInstanceId = NewMatchInstance ? NewMatchInstance->GetInstanceId() : INDEX_NONE;
+}
+
 void AMultiShootGameEnemyCharacter::MoveForward(float Value)
 {
 	AddMovementInput(GetActorForwardVector() * Value);
@@ -116,6 +216,146 @@ void AMultiShootGameEnemyCharacter::StopFire()
 	}
 }
 
+void AMultiShootGameEnemyCharacter::SetPooled(bool bNewPooled)
+{
+	if (bPooled == bNewPooled)
+	{
+		return;
+	}
+
+	bPooled = bNewPooled;
+
+	if (bPooled)
+	{
+		StopFire();
+		GetMovementComponent()->StopMovementImmediately();
+	}
+
+	SetActorHiddenInGame(bPooled);
+	SetActorEnableCollision(!bPooled);
+	SetActorTickEnabled(!bPooled);
+	GetMovementComponent()->SetComponentTickEnabled(!bPooled);
+	GetMesh()->SetComponentTickEnabled(!bPooled);
+	AIPerceptionComponent->SetComponentTickEnabled(!bPooled);
+
+	if (CurrentWeapon)
+	{
+		CurrentWeapon->SetActorHiddenInGame(bPooled);
+	}
+
+	const AAIController* AIController = Cast<AAIController>(GetController());
+	if (AIController && AIController->BrainComponent)
+	{
+		if (bPooled)
+		{
+			AIController->BrainComponent->PauseLogic(TEXT("Pooled"));
+		}
+		else
+		{
+			AIController->BrainComponent->ResumeLogic(TEXT("Pooled"));
+		}
+	}
+
+	UEnemyPerceptionSubsystem* EnemyPerceptionSubsystem = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>();
+	if (EnemyPerceptionSubsystem && bUseSharedPerception)
+	{
+		if (bPooled)
+		{
+			VisibleTargets.Reset();
+			EnemyPerceptionSubsystem->UnregisterBot(this);
+		}
+		else
+		{
+			EnemyPerceptionSubsystem->RegisterBot(this);
+		}
+	}
+
+	// Pooled bots send one hidden update and then stop replicating until they are promoted again
+	if (bPooled)
+	{
+		ForceNetUpdate();
+		SetNetDormancy(DORM_DormantAll);
+	}
+	else
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+}
+
+bool AMultiShootGameEnemyCharacter::MoveAlongFlowField(APawn* Target, float ScaleValue)
+{
+	UFlowFieldSubsystem* FlowFieldSubsystem = GetWorld()->GetSubsystem<UFlowFieldSubsystem>();
+	if (FlowFieldSubsystem == nullptr || HealthComponent->bDied)
+	{
+		return false;
+	}
+
+	FVector Direction;
+	if (!FlowFieldSubsystem->GetFlowDirection(Target, GetActorLocation(), Direction))
+	{
+		return false;
+	}
+
+	AddMovementInput(Direction, ScaleValue);
+
+	return true;
+}
+
+void AMultiShootGameEnemyCharacter::OnTargetSightChanged(APawn* Target, bool bVisible)
+{
+	if (bVisible)
+	{
+		VisibleTargets.AddUnique(Target);
+	}
+	else
+	{
+		VisibleTargets.Remove(Target);
+	}
+
+	VisibleTargets.RemoveAll([](const APawn* TempTarget)
+	{
+		return !IsValid(TempTarget);
+	});
+
+	// Controllers read the closest visible player from the blackboard
+	const AAIController* AIController = Cast<AAIController>(GetController());
+	UBlackboardComponent* BlackboardComponent = AIController ? AIController->GetBlackboardComponent() : nullptr;
+	if (BlackboardComponent)
+	{
+		const FBlackboard::FKey TargetActorKey = BlackboardComponent->GetKeyID(TargetActorKeyName);
+		if (TargetActorKey == FBlackboard::InvalidKey ||
+			BlackboardComponent->GetKeyType(TargetActorKey) != UBlackboardKeyType_Object::StaticClass())
+		{
+			if (!bReportedMissingTargetKey)
+			{
+				bReportedMissingTargetKey = true;
+
+				UE_LOG(LogMultiShootGame, Error, TEXT("%s: blackboard %s has no object key %s for shared perception"),
+				       *GetName(), *GetNameSafe(BlackboardComponent->GetBlackboardAsset()),
+				       *TargetActorKeyName.ToString());
+			}
+		}
+		else
+		{
+			APawn* ClosestTarget = nullptr;
+			float ClosestDistanceSquared = MAX_FLT;
+			for (APawn* TempTarget : VisibleTargets)
+			{
+				const float DistanceSquared = FVector::DistSquared(GetActorLocation(), TempTarget->GetActorLocation());
+				if (DistanceSquared < ClosestDistanceSquared)
+				{
+					ClosestDistanceSquared = DistanceSquared;
+					ClosestTarget = TempTarget;
+				}
+			}
+
+			BlackboardComponent->SetValue<UBlackboardKeyType_Object>(TargetActorKey, ClosestTarget);
+		}
+	}
+
+	OnTargetSightChangedEvent.Broadcast(Target, bVisible);
+}
+
 void AMultiShootGameEnemyCharacter::OnHeadShot(AActor* DamageCauser)
 {
 	if (!HealthComponent->bDied)
@@ -153,6 +393,12 @@ void AMultiShootGameEnemyCharacter::OnHealthChanged(UHealthComponent* OwningHeal
 	{
 		HealthComponent->bDied = true;
 
+		UEnemyPerceptionSubsystem* EnemyPerceptionSubsystem = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>();
+		if (EnemyPerceptionSubsystem)
+		{
+			EnemyPerceptionSubsystem->UnregisterBot(this);
+		}
+
 		GetMovementComponent()->StopMovementImmediately();
 		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 		GetMesh()->SetCollisionProfileName(FName("Ragdoll"));
@@ -165,7 +411,7 @@ void AMultiShootGameEnemyCharacter::OnHealthChanged(UHealthComponent* OwningHeal
 		AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(DamageCauser);
 		if (Character)
 		{
-			Character->OnEnemyKilled();
+			Character->OnEnemyKilled(this);
 		}
 
 		GetWorldTimerManager().SetTimer(TimerHandle, this, &AMultiShootGameEnemyCharacter::DeathDestroy,
@@ -12,6 +12,10 @@
 #include "Perception/AIPerceptionComponent.h"
 #include "MultiShootGameEnemyCharacter.generated.h"
 
+class AMultiShootGameMatchInstance;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTargetSightChangedSignature, APawn*, Target, bool, bVisible);
+
 UCLASS()
 class MULTISHOOTGAME_API AMultiShootGameEnemyCharacter : public ACharacter
 {
@@ -25,6 +29,10 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void PossessedBy(AController* NewController) override;
+
 	void MoveForward(float Value);
 
 	void MoveRight(float Value);
@@ -62,6 +70,24 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = Enemy)
 	FName WeaponSocketName = "WeaponSocket";
 
+	/**
+	 * Replaces the perception component's sight sense with the shared sight service. Off by default, since behavior
+	 * trees that listen to the engine sight sense stop seeing anything when it is on.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = Enemy)
+	bool bUseSharedPerception = false;
+
+	/** Object key that shared perception writes the closest visible player to. It must exist in the blackboard. */
+	UPROPERTY(EditDefaultsOnly, Category = Enemy, meta = (EditCondition = "bUseSharedPerception"))
+	FName TargetActorKeyName = "TargetActor";
+
+	bool bReportedMissingTargetKey = false;
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<APawn*> VisibleTargets;
+
+	bool bPooled = false;
+
 	UPROPERTY(BlueprintReadOnly)
 	AMultiShootGameEnemyWeapon* CurrentWeapon;
 
@@ -70,6 +96,10 @@ protected:
 
 	FTimerHandle TimerHandle;
 
+	int MatchInstanceId = INDEX_NONE;
+
+	TWeakObjectPtr<AMultiShootGameMatchInstance> MatchInstance;
+
 	UFUNCTION()
 	void OnHealthChanged(UHealthComponent* OwningHealthComponent, float Health, float HealthDelta,
 	                     const UDamageType* DamageType, AController* InstigatedBy, AActor* DamageCauser);
@@ -86,9 +116,40 @@ public:
 
 	virtual FVector GetPawnViewLocation() const override;
 
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+	                              const FVector& SrcLocation) const override;
+
 	UFUNCTION(BlueprintCallable, Category = Enemy)
 	void StartFire();
 
 	UFUNCTION(BlueprintCallable, Category = Enemy)
 	void StopFire();
+
+	void SetPooled(bool bNewPooled);
+
+	UFUNCTION(BlueprintPure, Category = Enemy)
+	FORCEINLINE bool IsPooled() const { return bPooled; }
+
+	FORCEINLINE bool IsUsingSharedPerception() const { return bUseSharedPerception; }
+
+	UFUNCTION(BlueprintPure, Category = Enemy)
+	FORCEINLINE UHealthComponent* GetHealthComponent() const { return HealthComponent; }
+
+	void SetMatchInstance(AMultiShootGameMatchInstance* NewMatchInstance);
+
+	UFUNCTION(BlueprintPure, Category = Enemy)
+	FORCEINLINE int GetMatchInstanceId() const { return MatchInstanceId; }
+
+	FORCEINLINE AMultiShootGameMatchInstance* GetMatchInstance() const { return MatchInstance.Get(); }
+
+	UFUNCTION(BlueprintCallable, Category = Enemy)
+	bool MoveAlongFlowField(APawn* Target, float ScaleValue = 1.f);
+
+	void OnTargetSightChanged(APawn* Target, bool bVisible);
+
+	UPROPERTY(BlueprintAssignable, Category = Enemy)
+	FOnTargetSightChangedSignature OnTargetSightChangedEvent;
+
+	UFUNCTION(BlueprintPure, Category = Enemy)
+	FORCEINLINE TArray<APawn*> GetVisibleTargets() const { return VisibleTargets; }
 };
@@ -2,7 +2,6 @@
 
 
 #include "MultiShootGamePlayGameCharacter.h"
-#include "Components/SceneCaptureComponent2D.h"
 
 // Sets default values
 AMultiShootGamePlayGameCharacter::AMultiShootGamePlayGameCharacter()
@@ -13,7 +12,7 @@ AMultiShootGamePlayGameCharacter::AMultiShootGamePlayGameCharacter()
 	CharacterMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("CharacterMeshComponent"));
 	RootComponent = CharacterMeshComponent;
 
-	SceneCaptureComponent2D = CreateDefaultSubobject<USceneCaptureComponent2D>(TEXT("SceneCaptureComponent2D"));
+	SceneCaptureComponent2D = CreateDefaultSubobject<UPreviewCaptureComponent>(TEXT("SceneCaptureComponent2D"));
 	SceneCaptureComponent2D->SetupAttachment(CharacterMeshComponent);
 
 	SpotLightComponent = CreateDefaultSubobject<USpotLightComponent>(TEXT("SpotLightComponent"));
@@ -31,3 +30,30 @@ void AMultiShootGamePlayGameCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 }
+
+void AMultiShootGamePlayGameCharacter::SetPreviewCharacterMesh(USkeletalMesh* CharacterMesh)
+{
+	if (CharacterMeshComponent->SkeletalMesh == CharacterMesh)
+	{
+		return;
+	}
+
+	CharacterMeshComponent->SetSkeletalMesh(CharacterMesh);
+
+	SceneCaptureComponent2D->RequestPreviewCapture();
+}
+
+void AMultiShootGamePlayGameCharacter::BeginPreviewRotation()
+{
+	SceneCaptureComponent2D->BeginPreviewRotation();
+}
+
+void AMultiShootGamePlayGameCharacter::EndPreviewRotation()
+{
+	SceneCaptureComponent2D->EndPreviewRotation();
+}
+
+void AMultiShootGamePlayGameCharacter::RequestPreviewCapture()
+{
+	SceneCaptureComponent2D->RequestPreviewCapture();
+}
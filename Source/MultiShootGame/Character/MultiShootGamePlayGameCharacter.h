@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/SpotLightComponent.h"
+#include "MultiShootGame/Component/PreviewCaptureComponent.h"
 #include "GameFramework/Actor.h"
 #include "MultiShootGamePlayGameCharacter.generated.h"
 
@@ -24,7 +25,7 @@ protected:
 	USkeletalMeshComponent* CharacterMeshComponent;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components)
-	USceneCaptureComponent2D* SceneCaptureComponent2D;
+	UPreviewCaptureComponent* SceneCaptureComponent2D;
 
 	UPROPERTY(VisibleAnywhere,BlueprintReadOnly,Category = Components)
 	USpotLightComponent* SpotLightComponent;
@@ -33,4 +34,20 @@ public:
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
 
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void SetPreviewCharacterMesh(USkeletalMesh* CharacterMesh);
+
+	/** Captures every frame between the two calls, e.g. while the player drags the preview around. */
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void BeginPreviewRotation();
+
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void EndPreviewRotation();
+
+	/** Re-renders the preview after a change the setters above don't cover. */
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void RequestPreviewCapture();
+
+	FORCEINLINE UPreviewCaptureComponent* GetPreviewCaptureComponent() const { return SceneCaptureComponent2D; }
+
 };
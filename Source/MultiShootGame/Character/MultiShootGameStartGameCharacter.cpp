@@ -2,7 +2,6 @@
 
 
 #include "MultiShootGameStartGameCharacter.h"
-#include "Components/SceneCaptureComponent2D.h"
 
 // Sets default values
 AMultiShootGameStartGameCharacter::AMultiShootGameStartGameCharacter()
@@ -16,7 +15,7 @@ AMultiShootGameStartGameCharacter::AMultiShootGameStartGameCharacter()
 	WeaponMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("WeaponMeshComponent"));
 	WeaponMeshComponent->SetupAttachment(CharacterMeshComponent, WeaponSocketName);
 
-	SceneCaptureComponent2D = CreateDefaultSubobject<USceneCaptureComponent2D>(TEXT("SceneCaptureComponent2D"));
+	SceneCaptureComponent2D = CreateDefaultSubobject<UPreviewCaptureComponent>(TEXT("SceneCaptureComponent2D"));
 	SceneCaptureComponent2D->SetupAttachment(CharacterMeshComponent);
 
 	SpotLightComponent = CreateDefaultSubobject<USpotLightComponent>(TEXT("SpotLightComponent"));
@@ -34,3 +33,42 @@ void AMultiShootGameStartGameCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 }
+
+void AMultiShootGameStartGameCharacter::SetPreviewWeaponMesh(USkeletalMesh* WeaponMesh)
+{
+	if (WeaponMeshComponent->SkeletalMesh == WeaponMesh)
+	{
+		return;
+	}
+
+	WeaponMeshComponent->SetSkeletalMesh(WeaponMesh);
+
+	SceneCaptureComponent2D->RequestPreviewCapture();
+}
+
+void AMultiShootGameStartGameCharacter::SetPreviewCharacterMesh(USkeletalMesh* CharacterMesh)
+{
+	if (CharacterMeshComponent->SkeletalMesh == CharacterMesh)
+	{
+		return;
+	}
+
+	CharacterMeshComponent->SetSkeletalMesh(CharacterMesh);
+
+	SceneCaptureComponent2D->RequestPreviewCapture();
+}
+
+void AMultiShootGameStartGameCharacter::BeginPreviewRotation()
+{
+	SceneCaptureComponent2D->BeginPreviewRotation();
+}
+
+void AMultiShootGameStartGameCharacter::EndPreviewRotation()
+{
+	SceneCaptureComponent2D->EndPreviewRotation();
+}
+
+void AMultiShootGameStartGameCharacter::RequestPreviewCapture()
+{
+	SceneCaptureComponent2D->RequestPreviewCapture();
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/SpotLightComponent.h"
+#include "MultiShootGame/Component/PreviewCaptureComponent.h"
 #include "MultiShootGameStartGameCharacter.generated.h"
 
 UCLASS()
@@ -26,7 +27,7 @@ protected:
 	USkeletalMeshComponent* WeaponMeshComponent;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components)
-	USceneCaptureComponent2D* SceneCaptureComponent2D;
+	UPreviewCaptureComponent* SceneCaptureComponent2D;
 
 	UPROPERTY(VisibleAnywhere,BlueprintReadOnly,Category = Components)
 	USpotLightComponent* SpotLightComponent;
@@ -37,5 +38,24 @@ protected:
 public:
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
+
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void SetPreviewWeaponMesh(USkeletalMesh* WeaponMesh);
+
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void SetPreviewCharacterMesh(USkeletalMesh* CharacterMesh);
+
+	/** Captures every frame between the two calls, e.g. while the player drags the preview around. */
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void BeginPreviewRotation();
+
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void EndPreviewRotation();
+
+	/** Re-renders the preview after a change the setters above don't cover. */
+	UFUNCTION(BlueprintCallable, Category = Preview)
+	void RequestPreviewCapture();
+
+	FORCEINLINE UPreviewCaptureComponent* GetPreviewCaptureComponent() const { return SceneCaptureComponent2D; }
 	
 };
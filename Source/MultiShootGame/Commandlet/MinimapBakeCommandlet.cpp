@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "MinimapBakeCommandlet.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/PackageName.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/DataAsset/MinimapTileSet.h"
+#include "RenderingThread.h"
+#include "UObject/Package.h"
+
+UMinimapBakeCommandlet::UMinimapBakeCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UMinimapBakeCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+	FString MapName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapName))
+	{
+		UE_LOG(LogMultiShootGame, Error, TEXT("Minimap bake: usage -Map=/Game/Maps/Level [-Output=/Game/Minimap] "
+			       "[-TileSize=4096] [-Resolution=1024]"));
+		return 1;
+	}
+
+	if (!IsAllowCommandletRendering())
+	{
+		UE_LOG(LogMultiShootGame, Error, TEXT("Minimap bake: run with -AllowCommandletRendering"));
+		return 1;
+	}
+
+	FString OutputPath = TEXT("/Game/Minimap");
+	float TileWorldSize = 4096.f;
+	int Resolution = 1024;
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	FParse::Value(*Params, TEXT("TileSize="), TileWorldSize);
+	FParse::Value(*Params, TEXT("Resolution="), Resolution);
+	TileWorldSize = FMath::Max(TileWorldSize, 1.f);
+	Resolution = FMath::Clamp(Resolution, 16, 8192);
+
+	UPackage* MapPackage = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogMultiShootGame, Error, TEXT("Minimap bake: can't load map %s"), *MapName);
+		return 1;
+	}
+
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+		                 .AllowAudioPlayback(false)
+		                 .CreatePhysicsScene(false)
+		                 .CreateNavigation(false)
+		                 .CreateAISystem(false)
+		                 .ShouldSimulatePhysics(false)
+		                 .SetTransactional(false));
+	}
+	World->UpdateWorldComponents(true, false);
+	World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+
+	const FBox LevelBounds = ALevelBounds::CalculateLevelBounds(World->PersistentLevel);
+	if (!LevelBounds.IsValid)
+	{
+		UE_LOG(LogMultiShootGame, Error, TEXT("Minimap bake: %s has no level bounds"), *MapName);
+		return 1;
+	}
+
+	const FString MapShortName = FPackageName::GetShortName(MapName);
+
+	const FString TileSetName = FString::Printf(TEXT("DA_%s_Minimap"), *MapShortName);
+	UPackage* TileSetPackage = CreatePackage(*FPaths::Combine(OutputPath, TileSetName));
+	UMinimapTileSet* TileSet = NewObject<UMinimapTileSet>(TileSetPackage, *TileSetName, RF_Public | RF_Standalone);
+	TileSet->Origin = FVector2D(LevelBounds.Min);
+	TileSet->TileWorldSize = TileWorldSize;
+	TileSet->NumTilesX = FMath::Max(FMath::CeilToInt(LevelBounds.GetSize().X / TileWorldSize), 1);
+	TileSet->NumTilesY = FMath::Max(FMath::CeilToInt(LevelBounds.GetSize().Y / TileWorldSize), 1);
+
+	UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>();
+	RenderTarget->RenderTargetFormat = RTF_RGBA8;
+	RenderTarget->InitAutoFormat(Resolution, Resolution);
+	RenderTarget->UpdateResourceImmediate(true);
+
+	USceneCaptureComponent2D* CaptureComponent = NewObject<USceneCaptureComponent2D>(World->GetWorldSettings());
+	CaptureComponent->ProjectionType = ECameraProjectionMode::Orthographic;
+	CaptureComponent->OrthoWidth = TileWorldSize;
+	CaptureComponent->CaptureSource = SCS_FinalColorLDR;
+	CaptureComponent->bCaptureEveryFrame = false;
+	CaptureComponent->bCaptureOnMovement = false;
+	CaptureComponent->TextureTarget = RenderTarget;
+	CaptureComponent->RegisterComponentWithWorld(World);
+
+	// Looking straight down puts world +X at the top of the texture, which UMinimapTileSet::GetTileUV relies on
+	const float CaptureHeight = LevelBounds.Max.Z + 100.f;
+
+	for (int TileY = 0; TileY < TileSet->NumTilesY; TileY++)
+	{
+		for (int TileX = 0; TileX < TileSet->NumTilesX; TileX++)
+		{
+			const FVector2D TileCenter = TileSet->Origin + FVector2D(TileX + 0.5f, TileY + 0.5f) * TileWorldSize;
+
+			CaptureComponent->SetWorldLocationAndRotation(FVector(TileCenter, CaptureHeight),
+			                                              FRotator(-90.f, 0.f, 0.f));
+			CaptureComponent->CaptureScene();
+			FlushRenderingCommands();
+
+			const FString TileName = FString::Printf(TEXT("T_%s_Minimap_%d_%d"), *MapShortName, TileX, TileY);
+			UPackage* TilePackage = CreatePackage(*FPaths::Combine(OutputPath, TileName));
+			UTexture2D* TileTexture = RenderTarget->ConstructTexture2D(TilePackage, TileName,
+			                                                           RF_Public | RF_Standalone);
+			if (TileTexture == nullptr || !SaveAsset(TileTexture))
+			{
+				UE_LOG(LogMultiShootGame, Error, TEXT("Minimap bake: failed to save tile %s"), *TileName);
+				return 1;
+			}
+
+			TileSet->Tiles.Add(TileTexture);
+		}
+	}
+
+	CaptureComponent->UnregisterComponent();
+	World->RemoveFromRoot();
+
+	if (!SaveAsset(TileSet))
+	{
+		UE_LOG(LogMultiShootGame, Error, TEXT("Minimap bake: failed to save %s"), *TileSetName);
+		return 1;
+	}
+
+	UE_LOG(LogMultiShootGame, Display, TEXT("Minimap bake: %s baked into %d x %d tiles"), *MapName,
+	       TileSet->NumTilesX, TileSet->NumTilesY);
+
+	return 0;
+#else
+	UE_LOG(LogMultiShootGame, Error, TEXT("Minimap bake: only available in editor builds"));
+
+	return 1;
+#endif
+}
+
+#if WITH_EDITOR
+bool UMinimapBakeCommandlet::SaveAsset(UObject* Asset)
+{
+	UPackage* Package = Asset->GetOutermost();
+	Package->MarkPackageDirty();
+
+	const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(),
+	                                                                 FPackageName::GetAssetPackageExtension());
+
+	return UPackage::SavePackage(Package, Asset, RF_Public | RF_Standalone, *Filename);
+}
+
+#endif
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MinimapBakeCommandlet.generated.h"
+
+/**
+ * Bakes a level into a UMinimapTileSet of top-down tile textures. Editor only, and needs rendering, so run it with
+ * -AllowCommandletRendering:
+ *
+ * UE4Editor-Cmd MultiShootGame.uproject -run=MinimapBake -Map=/Game/Maps/Level -AllowCommandletRendering
+ *     [-Output=/Game/Minimap] [-TileSize=4096] [-Resolution=1024]
+ */
+UCLASS()
+class MULTISHOOTGAME_API UMinimapBakeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMinimapBakeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+#if WITH_EDITOR
+	static bool SaveAsset(UObject* Asset);
+#endif
+};
@@ -3,6 +3,32 @@
 
 #include "HealthComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
+#include "MultiShootGame/Subsystem/CombatLogSubsystem.h"
+#include "MultiShootGame/Subsystem/DamageQueueSubsystem.h"
+#include "EngineUtils.h"
+#include "GameFramework/Character.h"
+
+TMap<TObjectKey<AActor>, UHealthComponent::FHealthRegistryEntry> UHealthComponent::HealthComponentRegistry;
+
+struct FTeamAttitudeTable
+{
+	ETeamAttitude::Type Attitudes[UHealthComponent::MaxTeams][UHealthComponent::MaxTeams];
+
+	FTeamAttitudeTable()
+	{
+		for (int TeamA = 0; TeamA < UHealthComponent::MaxTeams; TeamA++)
+		{
+			for (int TeamB = 0; TeamB < UHealthComponent::MaxTeams; TeamB++)
+			{
+				Attitudes[TeamA][TeamB] = TeamA == TeamB ? ETeamAttitude::Friendly : ETeamAttitude::Hostile;
+			}
+		}
+	}
+};
+
+static FTeamAttitudeTable TeamAttitudeTable;
 
 // Sets default values for this component's properties
 UHealthComponent::UHealthComponent()
@@ -11,7 +37,11 @@ UHealthComponent::UHealthComponent()
 	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
 
-	// ...
+	FHitZone HeadHitZone;
+	HeadHitZone.BoneName = FName("head");
+	HeadHitZone.DamageMultiplier = 2.5f;
+	HeadHitZone.bHeadShot = true;
+	HitZones.Add(HeadHitZone);
 }
 
 
@@ -23,6 +53,17 @@ void UHealthComponent::BeginPlay()
 	AActor* MyOwner = GetOwner();
 	if (MyOwner)
 	{
+		FHealthRegistryEntry& RegistryEntry = HealthComponentRegistry.Add(MyOwner);
+		RegistryEntry.HealthComponent = this;
+		RegistryEntry.TeamNumber = TeamNumber;
+
+		const ACharacter* Character = Cast<ACharacter>(MyOwner);
+		if (Character)
+		{
+			HitZoneMesh = Character->GetMesh();
+			HitZoneTable = FHitZoneTable::FindOrBuild(Character->GetMesh(), HitZones);
+		}
+
 		if (MyOwner->GetLocalRole() == ROLE_Authority)
 		{
 			MyOwner->OnTakeAnyDamage.AddDynamic(this, &UHealthComponent::HandleTakeAnyDamage);
@@ -30,6 +71,15 @@ void UHealthComponent::BeginPlay()
 	}
 }
 
+void UHealthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (GetOwner())
+	{
+		HealthComponentRegistry.Remove(GetOwner());
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
 
 void UHealthComponent::HandleTakeAnyDamage(AActor* DamagedActor, float Damage, const UDamageType* DamageType,
                                            AController* InstigatedBy, AActor* DamageCauser)
@@ -44,10 +94,62 @@ void UHealthComponent::HandleTakeAnyDamage(AActor* DamagedActor, float Damage, c
 		return;
 	}
 
+	if (!AMultiShootGamePlayerState::IsSameMatch(DamagedActor, InstigatedBy ? InstigatedBy : DamageCauser))
+	{
+		return;
+	}
+
+	const AActor* Attacker = InstigatedBy && InstigatedBy->GetPawn() ? InstigatedBy->GetPawn() : DamageCauser;
+	if (bIgnoreFriendlyDamage && GetTeamAttitude(DamagedActor, Attacker) == ETeamAttitude::Friendly)
+	{
+		return;
+	}
+
+	UCombatLogSubsystem::Record(this, ECombatEventType::Hit, Attacker, DamagedActor, Damage);
+
+	UDamageQueueSubsystem* DamageQueueSubsystem = GetWorld()->GetSubsystem<UDamageQueueSubsystem>();
+	if (DamageQueueSubsystem && DamageQueueSubsystem->QueueDamage(this, Damage, DamageType, InstigatedBy,
+	                                                              DamageCauser))
+	{
+		return;
+	}
+
+	ApplyDamage(Damage, DamageType, InstigatedBy, DamageCauser);
+}
+
+void UHealthComponent::ApplyDamage(float Damage, const UDamageType* DamageType, AController* InstigatedBy,
+                                   AActor* DamageCauser)
+{
+	if (Damage <= 0.0f || bDied)
+	{
+		return;
+	}
+
 	CurrentHealth = FMath::Clamp(CurrentHealth - Damage, 0.0f, DefaultHealth);
 	CurrentHealth = FMath::Floor(CurrentHealth);
 
 	OnHealthChanged.Broadcast(this, CurrentHealth, Damage, DamageType, InstigatedBy, DamageCauser);
+
+	if (GetOwner())
+	{
+		GetOwner()->ForceNetUpdate();
+	}
+}
+
+void UHealthComponent::NotifyHeadShot(AActor* DamageCauser)
+{
+	if (bDied)
+	{
+		return;
+	}
+
+	UDamageQueueSubsystem* DamageQueueSubsystem = GetWorld()->GetSubsystem<UDamageQueueSubsystem>();
+	if (DamageQueueSubsystem && DamageQueueSubsystem->QueueHeadShot(this, DamageCauser))
+	{
+		return;
+	}
+
+	OnHeadShot.Broadcast(DamageCauser);
 }
 
 // Called every frame
@@ -80,21 +182,135 @@ void UHealthComponent::Heal(float HealAmount)
 }
 
 bool UHealthComponent::IsFriendly(AActor* ActorA, AActor* ActorB)
+{
+	return GetTeamAttitude(ActorA, ActorB) != ETeamAttitude::Hostile;
+}
+
+UHealthComponent* UHealthComponent::FindHealthComponent(const AActor* Actor)
+{
+	const FHealthRegistryEntry* RegistryEntry = HealthComponentRegistry.Find(Actor);
+
+	return RegistryEntry ? RegistryEntry->HealthComponent.Get() : nullptr;
+}
+
+float UHealthComponent::GetHitZoneMultiplier(const AActor* Actor, const UPrimitiveComponent* HitComponent,
+                                             int32 BodyIndex, bool& bOutHeadShot)
+{
+	bOutHeadShot = false;
+
+	const UHealthComponent* HealthComponent = FindHealthComponent(Actor);
+	if (HealthComponent == nullptr || !HealthComponent->HitZoneTable.IsValid() ||
+		HitComponent != HealthComponent->HitZoneMesh.Get())
+	{
+		return 1.f;
+	}
+
+	const FHitZone* HitZone = HealthComponent->HitZoneTable->Find(BodyIndex);
+	if (HitZone == nullptr)
+	{
+		return 1.f;
+	}
+
+	bOutHeadShot = HitZone->bHeadShot;
+
+	return HitZone->DamageMultiplier;
+}
+
+ETeamAttitude::Type UHealthComponent::GetTeamAttitude(uint8 TeamA, uint8 TeamB)
+{
+	if (TeamA >= MaxTeams || TeamB >= MaxTeams)
+	{
+		return TeamA == TeamB ? ETeamAttitude::Friendly : ETeamAttitude::Hostile;
+	}
+
+	return TeamAttitudeTable.Attitudes[TeamA][TeamB];
+}
+
+ETeamAttitude::Type UHealthComponent::GetTeamAttitude(const AActor* ActorA, const AActor* ActorB)
 {
 	if (ActorA == nullptr || ActorB == nullptr)
 	{
-		return true;
+		return ETeamAttitude::Neutral;
 	}
 
-	UHealthComponent* HealthComponentA = Cast<UHealthComponent>(
-		ActorA->GetComponentByClass(UHealthComponent::StaticClass()));
-	UHealthComponent* HealthComponentB = Cast<UHealthComponent>(
-		ActorB->GetComponentByClass(UHealthComponent::StaticClass()));
+	const FHealthRegistryEntry* RegistryEntryA = HealthComponentRegistry.Find(ActorA);
+	const FHealthRegistryEntry* RegistryEntryB = HealthComponentRegistry.Find(ActorB);
 
-	if (HealthComponentA == nullptr || HealthComponentB == nullptr)
+	if (RegistryEntryA == nullptr || RegistryEntryB == nullptr)
 	{
-		return true;
+		return ETeamAttitude::Neutral;
 	}
 
-	return HealthComponentA->TeamNumber == HealthComponentB->TeamNumber;
+	return GetTeamAttitude(RegistryEntryA->TeamNumber, RegistryEntryB->TeamNumber);
 }
+
+void UHealthComponent::SetTeamAttitude(uint8 TeamA, uint8 TeamB, TEnumAsByte<ETeamAttitude::Type> Attitude)
+{
+	if (TeamA >= MaxTeams || TeamB >= MaxTeams)
+	{
+		return;
+	}
+
+	TeamAttitudeTable.Attitudes[TeamA][TeamB] = Attitude;
+	TeamAttitudeTable.Attitudes[TeamB][TeamA] = Attitude;
+}
+
+ETeamAttitude::Type UHealthComponent::SolveTeamAttitude(FGenericTeamId TeamA, FGenericTeamId TeamB)
+{
+	if (TeamA == FGenericTeamId::NoTeam || TeamB == FGenericTeamId::NoTeam)
+	{
+		return ETeamAttitude::Neutral;
+	}
+
+	return GetTeamAttitude(TeamA.GetId(), TeamB.GetId());
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkHealthLookupCommand(
+	TEXT("MultiShootGame.BenchmarkHealthLookup"),
+	TEXT("Compares GetComponentByClass with the health component registry over every actor in the world. ")
+	TEXT("Usage: MultiShootGame.BenchmarkHealthLookup [Iterations]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const int Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+
+		TArray<AActor*> Actors;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			Actors.Add(*It);
+		}
+
+		if (Actors.Num() == 0)
+		{
+			return;
+		}
+
+		int ScanFound = 0;
+		double StartTime = FPlatformTime::Seconds();
+		for (int i = 0; i < Iterations; i++)
+		{
+			for (const AActor* Actor : Actors)
+			{
+				ScanFound += Actor->GetComponentByClass(UHealthComponent::StaticClass()) != nullptr;
+			}
+		}
+		const double ScanTime = FPlatformTime::Seconds() - StartTime;
+
+		int RegistryFound = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int i = 0; i < Iterations; i++)
+		{
+			for (const AActor* Actor : Actors)
+			{
+				RegistryFound += UHealthComponent::FindHealthComponent(Actor) != nullptr;
+			}
+		}
+		const double RegistryTime = FPlatformTime::Seconds() - StartTime;
+
+		const double NumLookups = static_cast<double>(Iterations) * Actors.Num();
+		UE_LOG(LogMultiShootGame, Display,
+		       TEXT("Health lookup over %d actors x %d: GetComponentByClass %.1f ns (%d found), registry %.1f ns (%d found)"),
+		       Actors.Num(), Iterations, ScanTime * 1e9 / NumLookups, ScanFound / Iterations,
+		       RegistryTime * 1e9 / NumLookups, RegistryFound / Iterations);
+	}));
+#endif
@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "GenericTeamAgentInterface.h"
+#include "MultiShootGame/Struct/HitZone.h"
+#include "UObject/ObjectKey.h"
 #include "HealthComponent.generated.h"
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -25,6 +28,17 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	struct FHealthRegistryEntry
+	{
+		TWeakObjectPtr<UHealthComponent> HealthComponent;
+
+		uint8 TeamNumber = 0;
+	};
+
+	static TMap<TObjectKey<AActor>, FHealthRegistryEntry> HealthComponentRegistry;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Health)
 	float DefaultHealth = 100.f;
 
@@ -34,6 +48,16 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Health)
 	UAnimMontage* HitHeadMontage;
 
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Health)
+	bool bIgnoreFriendlyDamage = false;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Health)
+	TArray<FHitZone> HitZones;
+
+	TSharedPtr<const FHitZoneTable> HitZoneTable;
+
+	TWeakObjectPtr<const USkeletalMeshComponent> HitZoneMesh;
+
 	UFUNCTION(BlueprintCallable)
 	void Heal(float HealAmount);
 
@@ -54,6 +78,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = Health)
 	FORCEINLINE float GetHealth() const { return CurrentHealth; }
 
+	UFUNCTION(BlueprintPure, Category = Health)
+	FORCEINLINE float GetDefaultHealth() const { return DefaultHealth; }
+
+	FORCEINLINE void SetHealth(float NewHealth) { CurrentHealth = FMath::Clamp(NewHealth, 0.f, DefaultHealth); }
+
 	UPROPERTY(BlueprintAssignable, Category = Events)
 	FOnHealthChangedSignature OnHealthChanged;
 
@@ -65,4 +94,31 @@ public:
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = Health)
 	static bool IsFriendly(AActor* ActorA, AActor* ActorB);
+
+	/** Teams at or above this number skip the table: the same team is friendly, any other team hostile. */
+	static constexpr uint8 MaxTeams = 8;
+
+	static ETeamAttitude::Type GetTeamAttitude(uint8 TeamA, uint8 TeamB);
+
+	/** Cached team lookup through the registry, usable from damage, AI targeting and perception filters. */
+	static ETeamAttitude::Type GetTeamAttitude(const AActor* ActorA, const AActor* ActorB);
+
+	UFUNCTION(BlueprintCallable, Category = Health)
+	static void SetTeamAttitude(uint8 TeamA, uint8 TeamB, TEnumAsByte<ETeamAttitude::Type> Attitude);
+
+	/** FGenericTeamId attitude solver backed by the same table, registered by the game instance. */
+	static ETeamAttitude::Type SolveTeamAttitude(FGenericTeamId TeamA, FGenericTeamId TeamB);
+
+	/** Registry lookup filled in BeginPlay, replaces a component scan on the hit path. */
+	static UHealthComponent* FindHealthComponent(const AActor* Actor);
+
+	/** Damage multiplier of the physics body hit on the owner's mesh, 1 for anything outside the hit zone table. */
+	static float GetHitZoneMultiplier(const AActor* Actor, const UPrimitiveComponent* HitComponent, int32 BodyIndex,
+	                                  bool& bOutHeadShot);
+
+	/** Single health mutation, broadcast and net update for all damage this component took in one frame. */
+	void ApplyDamage(float Damage, const UDamageType* DamageType, AController* InstigatedBy, AActor* DamageCauser);
+
+	/** Records a headshot for scoring. Broadcast with the frame's batched damage, or right away without batching. */
+	void NotifyHeadShot(AActor* DamageCauser);
 };
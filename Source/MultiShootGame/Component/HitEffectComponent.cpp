@@ -3,6 +3,8 @@
 #include "HitEffectComponent.h"
 #include "MultiShootGame/MultiShootGame.h"
 #include "MultiShootGame/ParticleSystem/ImpactParticleSystem.h"
+#include "MultiShootGame/Subsystem/FrameBudgetSubsystem.h"
+#include "MultiShootGame/Subsystem/ImpactEffectSubsystem.h"
 
 // Sets default values for this component's properties
 UHitEffectComponent::UHitEffectComponent()
@@ -20,7 +22,14 @@ void UHitEffectComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// ...
+	UImpactEffectSubsystem* ImpactEffectSubsystem = GetWorld()->GetSubsystem<UImpactEffectSubsystem>();
+	if (ImpactEffectSubsystem)
+	{
+		ImpactEffectSubsystem->PrewarmImpactEffect(DefaultImpactEffect);
+		ImpactEffectSubsystem->PrewarmImpactEffect(FleshImpactEffect);
+		ImpactEffectSubsystem->PrewarmImpactEffect(StoneImpactEffect);
+		ImpactEffectSubsystem->PrewarmImpactEffect(WoodImpactEffect);
+	}
 }
 
 
@@ -33,26 +42,43 @@ void UHitEffectComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	// ...
 }
 
-void UHitEffectComponent::PlayHitEffect(EPhysicalSurface SurfaceType, FVector HitPoint, FRotator Rotation)
+TSubclassOf<AImpactParticleSystem> UHitEffectComponent::SelectImpactEffect(EPhysicalSurface SurfaceType) const
 {
-	TSubclassOf<AImpactParticleSystem> SelectEffect = nullptr;
-
 	switch (SurfaceType)
 	{
 	case SURFACE_CHARACTER:
 	case SURFACE_HEAD:
-		SelectEffect = FleshImpactEffect;
-		break;
+		return FleshImpactEffect;
 	case SURFACE_STONE:
-		SelectEffect = StoneImpactEffect;
-		break;
+		return StoneImpactEffect;
 	case SURFACE_WOOD:
-		SelectEffect = WoodImpactEffect;
-		break;
+		return WoodImpactEffect;
 	default:
-		SelectEffect = DefaultImpactEffect;
-		break;
+		return DefaultImpactEffect;
 	}
+}
 
-	GetWorld()->SpawnActor<AActor>(SelectEffect, HitPoint, Rotation);
+void UHitEffectComponent::PlayHitEffect(EPhysicalSurface SurfaceType, FVector HitPoint, FRotator Rotation)
+{
+	PlayImpactEffect(this, SelectImpactEffect(SurfaceType), HitPoint, Rotation);
+}
+
+void UHitEffectComponent::PlayImpactEffect(const UObject* WorldContextObject,
+                                           TSubclassOf<AImpactParticleSystem> EffectClass, FVector HitPoint,
+                                           FRotator Rotation)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (World == nullptr || EffectClass == nullptr)
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UImpactEffectSubsystem> WeakImpactEffectSubsystem = World->GetSubsystem<UImpactEffectSubsystem>();
+	UFrameBudgetSubsystem::RunCosmetic(World, [WeakImpactEffectSubsystem, EffectClass, HitPoint, Rotation]()
+	{
+		if (WeakImpactEffectSubsystem.IsValid())
+		{
+			WeakImpactEffectSubsystem->PlayImpactEffect(EffectClass, HitPoint, Rotation);
+		}
+	});
 }
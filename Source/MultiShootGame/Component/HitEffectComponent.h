@@ -37,4 +37,10 @@ public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	void PlayHitEffect(EPhysicalSurface SurfaceType, FVector HitPoint, FRotator Rotation);
+
+	TSubclassOf<AImpactParticleSystem> SelectImpactEffect(EPhysicalSurface SurfaceType) const;
+
+	/** Plays a pooled impact effect through the frame-budget cosmetic gate. */
+	static void PlayImpactEffect(const UObject* WorldContextObject, TSubclassOf<AImpactParticleSystem> EffectClass,
+	                             FVector HitPoint, FRotator Rotation);
 };
@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "MuzzleFlashComponent.h"
+#include "TimerManager.h"
+
+// Sets default values for this component's properties
+UMuzzleFlashComponent::UMuzzleFlashComponent()
+{
+	bAutoActivate = false;
+	bAutoDestroy = false;
+}
+
+void UMuzzleFlashComponent::PlayMuzzleFlash(UParticleSystem* Effect, UParticleSystem* BurstEffect)
+{
+	const UWorld* World = GetWorld();
+	if (World == nullptr || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	const float CurrentTime = World->GetTimeSeconds();
+	const bool bBurstShot = BurstEffect && LastShotTime >= 0.f && CurrentTime - LastShotTime <= BurstShotInterval;
+	LastShotTime = CurrentTime;
+
+	if (bBurstShot)
+	{
+		// The looping burst covers every following shot, it only has to be started once
+		if (!bBurstPlaying || Template != BurstEffect)
+		{
+			SetTemplate(BurstEffect);
+			Activate(true);
+			bBurstPlaying = true;
+		}
+
+		World->GetTimerManager().SetTimer(BurstTimerHandle, this, &UMuzzleFlashComponent::EndBurst,
+		                                  BurstShotInterval);
+		return;
+	}
+
+	if (Effect == nullptr)
+	{
+		return;
+	}
+
+	if (Template != Effect)
+	{
+		SetTemplate(Effect);
+	}
+
+	bBurstPlaying = false;
+	Activate(true);
+}
+
+void UMuzzleFlashComponent::StopMuzzleFlash()
+{
+	const UWorld* World = GetWorld();
+	if (World)
+	{
+		World->GetTimerManager().ClearTimer(BurstTimerHandle);
+	}
+
+	EndBurst();
+}
+
+void UMuzzleFlashComponent::EndBurst()
+{
+	if (bBurstPlaying)
+	{
+		bBurstPlaying = false;
+
+		// Let the live particles finish instead of popping them
+		DeactivateSystem();
+	}
+}
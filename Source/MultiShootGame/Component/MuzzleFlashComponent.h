@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "MuzzleFlashComponent.generated.h"
+
+/**
+ * Muzzle flash owned by a weapon for its whole lifetime and re-triggered on every shot, instead of spawning a new
+ * emitter per shot. Shots fired closer together than BurstShotInterval switch to the weapon's looping burst effect,
+ * which keeps running until the trigger is released.
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class MULTISHOOTGAME_API UMuzzleFlashComponent : public UParticleSystemComponent
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this component's properties
+	UMuzzleFlashComponent();
+
+protected:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = MuzzleFlash, meta = (ClampMin = 0.0f))
+	float BurstShotInterval = 0.2f;
+
+	FTimerHandle BurstTimerHandle;
+
+	float LastShotTime = -1.f;
+
+	bool bBurstPlaying = false;
+
+	void EndBurst();
+
+public:
+	/** Plays the flash for one shot. BurstEffect is optional and should loop. */
+	UFUNCTION(BlueprintCallable, Category = MuzzleFlash)
+	void PlayMuzzleFlash(UParticleSystem* Effect, UParticleSystem* BurstEffect = nullptr);
+
+	UFUNCTION(BlueprintCallable, Category = MuzzleFlash)
+	void StopMuzzleFlash();
+
+	UFUNCTION(BlueprintPure, Category = MuzzleFlash)
+	FORCEINLINE bool IsBurstPlaying() const { return bBurstPlaying; }
+};
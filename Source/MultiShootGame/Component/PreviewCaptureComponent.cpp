@@ -0,0 +1,141 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PreviewCaptureComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Actor.h"
+#include "MultiShootGame/MultiShootGame.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Preview Captures"), STAT_PreviewCaptures, STATGROUP_MultiShootGame);
+
+// Sets default values for this component's properties
+UPreviewCaptureComponent::UPreviewCaptureComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	bCaptureEveryFrame = false;
+	bCaptureOnMovement = false;
+}
+
+// Called when the game starts
+void UPreviewCaptureComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// The base component captures every frame from its tick, which this one starts with disabled
+	if (!bCaptureOnChange)
+	{
+		bCaptureEveryFrame = true;
+		SetComponentTickEnabled(true);
+		return;
+	}
+
+	bCaptureEveryFrame = false;
+	bCaptureOnMovement = false;
+
+	CheckForChanges();
+	RequestPreviewCapture();
+
+	GetWorld()->GetTimerManager().SetTimer(ChangeCheckTimerHandle, this, &UPreviewCaptureComponent::CheckForChanges,
+	                                       ChangeCheckInterval, true);
+}
+
+void UPreviewCaptureComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	const UWorld* World = GetWorld();
+	if (World)
+	{
+		World->GetTimerManager().ClearTimer(ChangeCheckTimerHandle);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+// Called every frame
+void UPreviewCaptureComponent::TickComponent(float DeltaTime, ELevelTick TickType,
+                                             FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Capturing every frame is left to the base component
+	if (!bCaptureOnChange)
+	{
+		return;
+	}
+
+	CaptureSceneDeferred();
+	INC_DWORD_STAT(STAT_PreviewCaptures);
+
+	if (!bRotating)
+	{
+		RemainingSettleTime -= DeltaTime;
+		if (RemainingSettleTime <= 0.f)
+		{
+			SetComponentTickEnabled(false);
+		}
+	}
+}
+
+void UPreviewCaptureComponent::CheckForChanges()
+{
+	const AActor* Owner = GetOwner();
+	if (Owner == nullptr)
+	{
+		return;
+	}
+
+	TInlineComponentArray<USkeletalMeshComponent*> MeshComponents(Owner);
+
+	bool bChanged = MeshComponents.Num() != WatchedMeshes.Num() ||
+		!LastCaptureTransform.Equals(GetComponentTransform());
+	WatchedMeshes.SetNum(MeshComponents.Num());
+	LastCaptureTransform = GetComponentTransform();
+
+	for (int i = 0; i < MeshComponents.Num(); i++)
+	{
+		const USkeletalMeshComponent* MeshComponent = MeshComponents[i];
+		FWatchedMesh& WatchedMesh = WatchedMeshes[i];
+
+		if (WatchedMesh.MeshComponent.Get() != MeshComponent ||
+			WatchedMesh.SkeletalMesh.Get() != MeshComponent->SkeletalMesh ||
+			WatchedMesh.bVisible != MeshComponent->IsVisible() ||
+			!WatchedMesh.ComponentTransform.Equals(MeshComponent->GetComponentTransform()))
+		{
+			WatchedMesh.MeshComponent = MeshComponent;
+			WatchedMesh.SkeletalMesh = MeshComponent->SkeletalMesh;
+			WatchedMesh.ComponentTransform = MeshComponent->GetComponentTransform();
+			WatchedMesh.bVisible = MeshComponent->IsVisible();
+			bChanged = true;
+		}
+	}
+
+	if (bChanged)
+	{
+		RequestPreviewCapture();
+	}
+}
+
+void UPreviewCaptureComponent::RequestPreviewCapture()
+{
+	if (!bCaptureOnChange)
+	{
+		return;
+	}
+
+	RemainingSettleTime = SettleTime;
+	SetComponentTickEnabled(true);
+}
+
+void UPreviewCaptureComponent::BeginPreviewRotation()
+{
+	bRotating = true;
+
+	RequestPreviewCapture();
+}
+
+void UPreviewCaptureComponent::EndPreviewRotation()
+{
+	bRotating = false;
+
+	RequestPreviewCapture();
+}
@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "PreviewCaptureComponent.generated.h"
+
+class USkeletalMesh;
+class USkeletalMeshComponent;
+
+/**
+ * Scene capture for menu previews that only renders when something changes. The render target keeps the last
+ * capture, so an unchanged preview costs nothing. A low-rate check watches the owner's skeletal meshes and
+ * transforms, so Blueprints that swap meshes or turn the preview directly still refresh it. A change captures for
+ * SettleTime to let animation blends and texture streaming catch up, and rotating captures every frame until it ends.
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class MULTISHOOTGAME_API UPreviewCaptureComponent : public USceneCaptureComponent2D
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this component's properties
+	UPreviewCaptureComponent();
+
+protected:
+	// Called when the game starts
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** When false the component falls back to capturing every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = PreviewCapture)
+	bool bCaptureOnChange = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = PreviewCapture, meta = (ClampMin = 0.0f))
+	float SettleTime = 0.5f;
+
+	/** How often the owner's meshes and transforms are checked for changes nobody reported. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = PreviewCapture, meta = (ClampMin = 0.01f))
+	float ChangeCheckInterval = 0.1f;
+
+	struct FWatchedMesh
+	{
+		TWeakObjectPtr<const USkeletalMeshComponent> MeshComponent;
+
+		TWeakObjectPtr<const USkeletalMesh> SkeletalMesh;
+
+		FTransform ComponentTransform;
+
+		bool bVisible = false;
+	};
+
+	TArray<FWatchedMesh> WatchedMeshes;
+
+	FTransform LastCaptureTransform;
+
+	FTimerHandle ChangeCheckTimerHandle;
+
+	float RemainingSettleTime = 0.f;
+
+	bool bRotating = false;
+
+	void CheckForChanges();
+
+public:
+	// Called every frame
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
+	                           FActorComponentTickFunction* ThisTickFunction) override;
+
+	UFUNCTION(BlueprintCallable, Category = PreviewCapture)
+	void RequestPreviewCapture();
+
+	UFUNCTION(BlueprintCallable, Category = PreviewCapture)
+	void BeginPreviewRotation();
+
+	UFUNCTION(BlueprintCallable, Category = PreviewCapture)
+	void EndPreviewRotation();
+};
@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "WeaponAudioComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "Sound/SoundBase.h"
+#include "TimerManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Weapon Audio Loop Voices"), STAT_WeaponAudioLoopVoices, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Weapon Audio One-Shot Voices"), STAT_WeaponAudioOneShotVoices,
+                           STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Weapon Audio Culled"), STAT_WeaponAudioCulled, STATGROUP_MultiShootGame);
+
+// Sets default values for this component's properties
+UWeaponAudioComponent::UWeaponAudioComponent()
+{
+	bAutoActivate = false;
+	bAutoDestroy = false;
+}
+
+void UWeaponAudioComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	const UWorld* World = GetWorld();
+	if (World)
+	{
+		World->GetTimerManager().ClearTimer(LoopTimerHandle);
+	}
+
+	if (bLoopPlaying)
+	{
+		bLoopPlaying = false;
+		DEC_DWORD_STAT(STAT_WeaponAudioLoopVoices);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UWeaponAudioComponent::PlayFireSound(USoundBase* ShotSound, USoundBase* LoopSound, USoundBase* TailSound,
+                                          USoundConcurrency* Concurrency)
+{
+	const UWorld* World = GetWorld();
+	if (World == nullptr || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	const float CurrentTime = World->GetTimeSeconds();
+	const bool bLoopShot = LoopSound && LastShotTime >= 0.f && CurrentTime - LastShotTime <= LoopShotInterval;
+	LastShotTime = CurrentTime;
+
+	if (!bLoopShot)
+	{
+		PlayOneShot(ShotSound, Concurrency);
+		return;
+	}
+
+	// The loop covers every following shot, it only has to be started once
+	if (!bLoopPlaying || Sound != LoopSound)
+	{
+		if (IsAudible(LoopSound))
+		{
+			SetSound(LoopSound);
+
+			ConcurrencySet.Reset();
+			if (Concurrency)
+			{
+				ConcurrencySet.Add(Concurrency);
+			}
+
+			Play();
+
+			if (!bLoopPlaying)
+			{
+				bLoopPlaying = true;
+				INC_DWORD_STAT(STAT_WeaponAudioLoopVoices);
+			}
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_WeaponAudioCulled);
+		}
+	}
+
+	CurrentTailSound = TailSound;
+	CurrentConcurrency = Concurrency;
+
+	World->GetTimerManager().SetTimer(LoopTimerHandle, this, &UWeaponAudioComponent::EndLoop, LoopShotInterval);
+}
+
+void UWeaponAudioComponent::StopFireSound()
+{
+	const UWorld* World = GetWorld();
+	if (World)
+	{
+		World->GetTimerManager().ClearTimer(LoopTimerHandle);
+	}
+
+	EndLoop();
+}
+
+void UWeaponAudioComponent::EndLoop()
+{
+	if (!bLoopPlaying)
+	{
+		return;
+	}
+
+	bLoopPlaying = false;
+	DEC_DWORD_STAT(STAT_WeaponAudioLoopVoices);
+
+	Stop();
+
+	PlayOneShot(CurrentTailSound, CurrentConcurrency);
+}
+
+bool UWeaponAudioComponent::IsAudible(const USoundBase* InSound) const
+{
+	return UGameplayStatics::AreAnyListenersWithinRange(this, GetComponentLocation(), InSound->GetMaxDistance());
+}
+
+void UWeaponAudioComponent::PlayOneShot(USoundBase* InSound, USoundConcurrency* Concurrency)
+{
+	if (InSound == nullptr)
+	{
+		return;
+	}
+
+	if (!IsAudible(InSound))
+	{
+		INC_DWORD_STAT(STAT_WeaponAudioCulled);
+		return;
+	}
+
+	UGameplayStatics::PlaySoundAtLocation(this, InSound, GetComponentLocation(), GetComponentRotation(), 1.f, 1.f, 0.f,
+	                                      nullptr, Concurrency, GetOwner());
+
+	INC_DWORD_STAT(STAT_WeaponAudioOneShotVoices);
+}
@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/AudioComponent.h"
+#include "WeaponAudioComponent.generated.h"
+
+class USoundConcurrency;
+
+/**
+ * Fire audio owned by a weapon. Single shots are one-shot voices; shots fired closer together than LoopShotInterval
+ * hand over to one looping voice on this component, which plays the tail sound when the trigger is released. Voices
+ * out of every listener's range are culled before they are created.
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class MULTISHOOTGAME_API UWeaponAudioComponent : public UAudioComponent
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this component's properties
+	UWeaponAudioComponent();
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = WeaponAudio, meta = (ClampMin = 0.0f))
+	float LoopShotInterval = 0.2f;
+
+	UPROPERTY()
+	USoundBase* CurrentTailSound;
+
+	UPROPERTY()
+	USoundConcurrency* CurrentConcurrency;
+
+	FTimerHandle LoopTimerHandle;
+
+	float LastShotTime = -1.f;
+
+	bool bLoopPlaying = false;
+
+	void EndLoop();
+
+	bool IsAudible(const USoundBase* InSound) const;
+
+	void PlayOneShot(USoundBase* InSound, USoundConcurrency* Concurrency);
+
+public:
+	/** Plays the sound for one shot. LoopSound and TailSound are optional; without a loop every shot is a one-shot. */
+	UFUNCTION(BlueprintCallable, Category = WeaponAudio)
+	void PlayFireSound(USoundBase* ShotSound, USoundBase* LoopSound = nullptr, USoundBase* TailSound = nullptr,
+	                   USoundConcurrency* Concurrency = nullptr);
+
+	UFUNCTION(BlueprintCallable, Category = WeaponAudio)
+	void StopFireSound();
+
+	UFUNCTION(BlueprintPure, Category = WeaponAudio)
+	FORCEINLINE bool IsLoopPlaying() const { return bLoopPlaying; }
+};
@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "MinimapTileSet.h"
+
+FIntPoint UMinimapTileSet::GetTileCoord(FVector WorldLocation) const
+{
+	return FIntPoint(FMath::FloorToInt((WorldLocation.X - Origin.X) / TileWorldSize),
+	                 FMath::FloorToInt((WorldLocation.Y - Origin.Y) / TileWorldSize));
+}
+
+TSoftObjectPtr<UTexture2D> UMinimapTileSet::GetTile(FIntPoint TileCoord) const
+{
+	if (TileCoord.X < 0 || TileCoord.X >= NumTilesX || TileCoord.Y < 0 || TileCoord.Y >= NumTilesY)
+	{
+		return nullptr;
+	}
+
+	const int TileIndex = TileCoord.Y * NumTilesX + TileCoord.X;
+
+	return Tiles.IsValidIndex(TileIndex) ? Tiles[TileIndex] : nullptr;
+}
+
+FVector2D UMinimapTileSet::GetTileUV(FVector WorldLocation) const
+{
+	const FIntPoint TileCoord = GetTileCoord(WorldLocation);
+
+	const float TileX = (WorldLocation.X - Origin.X) / TileWorldSize - TileCoord.X;
+	const float TileY = (WorldLocation.Y - Origin.Y) / TileWorldSize - TileCoord.Y;
+
+	// World +X is up in the texture and world +Y is right
+	return FVector2D(TileY, 1.f - TileX);
+}
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/Texture2D.h"
+#include "MinimapTileSet.generated.h"
+
+/**
+ * Top-down textures of a level, baked offline by UMinimapBakeCommandlet. Tiles are square, laid out on the world XY
+ * grid from Origin and captured looking down with world +X at the top of the texture.
+ */
+UCLASS(BlueprintType)
+class MULTISHOOTGAME_API UMinimapTileSet : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** World XY of the minimum corner of tile (0, 0). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minimap)
+	FVector2D Origin = FVector2D::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minimap, meta = (ClampMin = 1.0f))
+	float TileWorldSize = 4096.f;
+
+	/** Tiles along world X. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minimap)
+	int NumTilesX = 0;
+
+	/** Tiles along world Y. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minimap)
+	int NumTilesY = 0;
+
+	/** NumTilesX * NumTilesY entries, indexed by TileY * NumTilesX + TileX. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minimap)
+	TArray<TSoftObjectPtr<UTexture2D>> Tiles;
+
+	UFUNCTION(BlueprintPure, Category = Minimap)
+	FIntPoint GetTileCoord(FVector WorldLocation) const;
+
+	/** Returns a null pointer outside the baked area. */
+	UFUNCTION(BlueprintPure, Category = Minimap)
+	TSoftObjectPtr<UTexture2D> GetTile(FIntPoint TileCoord) const;
+
+	/** Where a world location falls inside its tile texture, 0 to 1 on both axes. */
+	UFUNCTION(BlueprintPure, Category = Minimap)
+	FVector2D GetTileUV(FVector WorldLocation) const;
+};
@@ -0,0 +1 @@
+﻿#include "ECombatEventType.h"
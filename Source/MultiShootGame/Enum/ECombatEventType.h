@@ -0,0 +1,10 @@
+﻿#pragma once
+
+UENUM(BlueprintType)
+enum class ECombatEventType : uint8
+{
+	Shot UMETA(DisplayName = "Shot"),
+	Hit UMETA(DisplayName = "Hit"),
+	Kill UMETA(DisplayName = "Kill"),
+	Death UMETA(DisplayName = "Death")
+};
\ No newline at end of file
@@ -0,0 +1 @@
+﻿#include "EFrameBudgetLevel.h"
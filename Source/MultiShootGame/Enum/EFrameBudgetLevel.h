@@ -0,0 +1,11 @@
+﻿#pragma once
+
+UENUM(BlueprintType)
+enum class EFrameBudgetLevel : uint8
+{
+	Normal UMETA(DisplayName = "Normal"),
+	ReducedNetUpdate UMETA(DisplayName = "ReducedNetUpdate"),
+	DeferredCosmetics UMETA(DisplayName = "DeferredCosmetics"),
+	StretchedAI UMETA(DisplayName = "StretchedAI"),
+	ThrottledSpawn UMETA(DisplayName = "ThrottledSpawn")
+};
\ No newline at end of file
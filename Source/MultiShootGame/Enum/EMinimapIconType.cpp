@@ -0,0 +1 @@
+﻿#include "EMinimapIconType.h"
@@ -0,0 +1,10 @@
+﻿#pragma once
+
+UENUM(BlueprintType)
+enum class EMinimapIconType : uint8
+{
+	Self UMETA(DisplayName = "Self"),
+	Friendly UMETA(DisplayName = "Friendly"),
+	Hostile UMETA(DisplayName = "Hostile"),
+	Pickup UMETA(DisplayName = "Pickup")
+};
\ No newline at end of file
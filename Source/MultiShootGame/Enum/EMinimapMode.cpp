@@ -0,0 +1 @@
+﻿#include "EMinimapMode.h"
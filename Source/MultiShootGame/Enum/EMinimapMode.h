@@ -0,0 +1,9 @@
+﻿#pragma once
+
+UENUM(BlueprintType)
+enum class EMinimapMode : uint8
+{
+	SceneCapture UMETA(DisplayName = "Scene Capture"),
+	BakedTiles UMETA(DisplayName = "Baked Tiles"),
+	BakedTilesWithCapture UMETA(DisplayName = "Baked Tiles With Capture")
+};
\ No newline at end of file
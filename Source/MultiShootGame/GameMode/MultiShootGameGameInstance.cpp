@@ -1,4 +1,12 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "MultiShootGameGameInstance.h"
+#include "MultiShootGame/Component/HealthComponent.h"
+
+void UMultiShootGameGameInstance::Init()
+{
+	Super::Init();
+
+	FGenericTeamId::SetAttitudeSolver(&UHealthComponent::SolveTeamAttitude);
+}
 
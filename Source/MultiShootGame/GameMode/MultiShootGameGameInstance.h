@@ -16,6 +16,8 @@ class MULTISHOOTGAME_API UMultiShootGameGameInstance : public UGameInstance
 	GENERATED_BODY()
 
 public:
+	virtual void Init() override;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = GameInstance)
 	EGameTime GameTime = EGameTime::Daytime;
 
@@ -2,10 +2,13 @@
 
 #include "MultiShootGameGameMode.h"
 #include "MultiShootGameGameState.h"
+#include "EngineUtils.h"
 #include "Kismet/GameplayStatics.h"
-#include "MultiShootGame/Character/MultiShootGameCharacter.h"
 #include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
+#include "MultiShootGame/MultiShootGame.h"
 #include "MultiShootGame/Component/HealthComponent.h"
+#include "MultiShootGame/Subsystem/EnemyProxySubsystem.h"
+#include "MultiShootGame/Subsystem/FrameBudgetSubsystem.h"
 
 AMultiShootGameGameMode::AMultiShootGameGameMode()
 	: Super()
@@ -20,6 +23,20 @@ AMultiShootGameGameMode::AMultiShootGameGameMode()
 void AMultiShootGameGameMode::BeginPlay()
 {
 	Super::BeginPlay();
+
+	for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+	{
+		if (It->ActorHasTag(BotSpawnTag))
+		{
+			BotSpawnPoints.Add(*It);
+		}
+	}
+
+	if (BotClass && BotSpawnPoints.Num() == 0)
+	{
+		UE_LOG(LogMultiShootGame, Warning, TEXT("No actors tagged %s, bots spawn only from SpawnNewBot overrides"),
+		       *BotSpawnTag.ToString());
+	}
 }
 
 void AMultiShootGameGameMode::StartPlay()
@@ -61,6 +78,14 @@ void AMultiShootGameGameMode::PrepareForNextWave()
 
 void AMultiShootGameGameMode::SpawnBotTimerElapsed()
 {
+	const UFrameBudgetSubsystem* FrameBudgetSubsystem = GetWorld()->GetSubsystem<UFrameBudgetSubsystem>();
+	if (FrameBudgetSubsystem && FrameBudgetSubsystem->IsSpawnThrottled())
+	{
+		UE_LOG(LogMultiShootGame, Verbose, TEXT("Frame budget: bot spawn deferred (%d remaining)"),
+		       NumberOfBotsToSpawn);
+		return;
+	}
+
 	SpawnNewBot();
 
 	NumberOfBotsToSpawn--;
@@ -71,6 +96,36 @@ void AMultiShootGameGameMode::SpawnBotTimerElapsed()
 	}
 }
 
+void AMultiShootGameGameMode::SpawnNewBot_Implementation()
+{
+	if (BotSpawnPoints.Num() == 0)
+	{
+		return;
+	}
+
+	const AActor* SpawnPoint = BotSpawnPoints[FMath::RandHelper(BotSpawnPoints.Num())];
+	if (SpawnPoint)
+	{
+		SpawnBot(SpawnPoint->GetActorLocation(), SpawnPoint->GetActorRotation());
+	}
+}
+
+void AMultiShootGameGameMode::SpawnBot(FVector Location, FRotator Rotation)
+{
+	UEnemyProxySubsystem* EnemyProxySubsystem = GetWorld()->GetSubsystem<UEnemyProxySubsystem>();
+	if (EnemyProxySubsystem)
+	{
+		EnemyProxySubsystem->SpawnEnemy(BotClass, Location, Rotation);
+		return;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride =
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	GetWorld()->SpawnActor<AMultiShootGameEnemyCharacter>(BotClass, Location, Rotation, SpawnParameters);
+}
+
 void AMultiShootGameGameMode::GameOver()
 {
 	EndWave();
@@ -85,20 +140,28 @@ void AMultiShootGameGameMode::CheckWaveState()
 		return;
 	}
 
-	bool bIsAnyBotAlive = false;
+	// Distant bots that only exist as proxies are still alive
+	const UEnemyProxySubsystem* EnemyProxySubsystem = GetWorld()->GetSubsystem<UEnemyProxySubsystem>();
+
+	bool bIsAnyBotAlive = EnemyProxySubsystem && EnemyProxySubsystem->GetNumProxies() > 0;
 
 	TArray<AActor*> Actors;
 	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), Actors);
 	for (AActor* Iterator : Actors)
 	{
+		if (bIsAnyBotAlive)
+		{
+			break;
+		}
+
 		APawn* TestPawn = Cast<APawn>(Iterator);
-		if (TestPawn == nullptr || TestPawn->IsPlayerControlled())
+		const AMultiShootGameEnemyCharacter* EnemyCharacter = Cast<AMultiShootGameEnemyCharacter>(TestPawn);
+		if (TestPawn == nullptr || TestPawn->IsPlayerControlled() || (EnemyCharacter && EnemyCharacter->IsPooled()))
 		{
 			continue;
 		}
 
-		UHealthComponent* HealthComponent = Cast<UHealthComponent>(
-			TestPawn->GetComponentByClass(UHealthComponent::StaticClass()));
+		const UHealthComponent* HealthComponent = UHealthComponent::FindHealthComponent(TestPawn);
 
 		if (HealthComponent && HealthComponent->GetHealth() > 0)
 		{
@@ -117,33 +180,48 @@ void AMultiShootGameGameMode::CheckWaveState()
 
 void AMultiShootGameGameMode::CheckAnyPlayerAlive()
 {
-	const AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(
-		UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
-	if (Character)
+	if (AlivePlayerControllers.Num() > 0 || GetWaveState() == EWaveState::GameOver)
 	{
-		if (Character->GetHealthComponent()->bDied)
-		{
-			GameOver();
-			return;
-		}
+		return;
 	}
 
-	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	GameOver();
+}
+
+void AMultiShootGameGameMode::RestartPlayer(AController* NewPlayer)
+{
+	Super::RestartPlayer(NewPlayer);
+
+	if (NewPlayer && NewPlayer->GetPawn())
 	{
-		APlayerController* PlayerController = Iterator->Get();
-		if (PlayerController && PlayerController->GetPawn())
-		{
-			APawn* PlayerPawn = PlayerController->GetPawn();
-			UHealthComponent* HealthComponent = Cast<UHealthComponent>(
-				PlayerPawn->GetComponentByClass(UHealthComponent::StaticClass()));
-			if (ensure(HealthComponent) && HealthComponent->GetHealth() > 0.0f)
-			{
-				return;
-			}
-		}
+		OnPlayerAlive(NewPlayer);
 	}
+}
 
-	GameOver();
+void AMultiShootGameGameMode::Logout(AController* Exiting)
+{
+	Super::Logout(Exiting);
+
+	if (AlivePlayerControllers.Remove(Exiting) > 0)
+	{
+		CheckAnyPlayerAlive();
+	}
+}
+
+void AMultiShootGameGameMode::OnPlayerAlive(AController* PlayerController)
+{
+	if (PlayerController && PlayerController->IsPlayerController())
+	{
+		AlivePlayerControllers.Add(PlayerController);
+	}
+}
+
+void AMultiShootGameGameMode::OnPlayerDied(AController* PlayerController)
+{
+	if (AlivePlayerControllers.Remove(PlayerController) > 0)
+	{
+		CheckAnyPlayerAlive();
+	}
 }
 
 void AMultiShootGameGameMode::CheckNumberOfBots()
@@ -154,13 +232,15 @@ void AMultiShootGameGameMode::CheckNumberOfBots()
 	for (int i = 0; i < OutActors.Num(); i++)
 	{
 		AMultiShootGameEnemyCharacter* EnemyCharacter = Cast<AMultiShootGameEnemyCharacter>(OutActors[i]);
-		if (Cast<UHealthComponent>(EnemyCharacter->GetComponentByClass(UHealthComponent::StaticClass()))->bDied)
+		if (EnemyCharacter->IsPooled() || EnemyCharacter->GetHealthComponent()->bDied)
 		{
 			continue;
 		}
 		Count++;
 	}
-	NumberOfBots = Count;
+
+	const UEnemyProxySubsystem* EnemyProxySubsystem = GetWorld()->GetSubsystem<UEnemyProxySubsystem>();
+	NumberOfBots = Count + (EnemyProxySubsystem ? EnemyProxySubsystem->GetNumProxies() : 0);
 }
 
 void AMultiShootGameGameMode::SetWaveState(EWaveState NewState) const
@@ -202,7 +282,5 @@ void AMultiShootGameGameMode::Tick(float DeltaSeconds)
 
 	CheckWaveState();
 
-	CheckAnyPlayerAlive();
-
 	CheckNumberOfBots();
 }
@@ -7,6 +7,8 @@
 #include "MultiShootGame/Enum/EWaveState.h"
 #include "MultiShootGameGameMode.generated.h"
 
+class AMultiShootGameEnemyCharacter;
+
 UCLASS(minimalapi)
 class AMultiShootGameGameMode : public AGameMode
 {
@@ -21,9 +23,27 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
-	UFUNCTION(BlueprintImplementableEvent, Category = GameMode)
+	/**
+	 * Spawns one bot of the wave at a random actor tagged BotSpawnTag. Blueprint overrides that pick their own
+	 * location, such as an EQS query, must finish with SpawnBot rather than spawning the actor themselves, so the
+	 * bot goes through the proxy subsystem.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = GameMode)
 	void SpawnNewBot();
 
+	/** Adds a wave bot through UEnemyProxySubsystem::SpawnEnemy, as a proxy while no player is near. */
+	UFUNCTION(BlueprintCallable, Category = GameMode)
+	void SpawnBot(FVector Location, FRotator Rotation);
+
+	UPROPERTY(EditDefaultsOnly, Category = GameMode)
+	TSubclassOf<AMultiShootGameEnemyCharacter> BotClass;
+
+	UPROPERTY(EditDefaultsOnly, Category = GameMode)
+	FName BotSpawnTag = "BotSpawn";
+
+	UPROPERTY()
+	TArray<AActor*> BotSpawnPoints;
+
 	void SpawnBotTimerElapsed();
 
 	void StartWave();
@@ -54,6 +74,9 @@ protected:
 
 	void CheckAnyPlayerAlive();
 
+	UPROPERTY()
+	TSet<AController*> AlivePlayerControllers;
+
 	void CheckNumberOfBots();
 
 	void SetWaveState(EWaveState NewState) const;
@@ -65,4 +88,12 @@ protected:
 
 public:
 	virtual void Tick(float DeltaSeconds) override;
+
+	virtual void RestartPlayer(AController* NewPlayer) override;
+
+	virtual void Logout(AController* Exiting) override;
+
+	void OnPlayerAlive(AController* PlayerController);
+
+	void OnPlayerDied(AController* PlayerController);
 };
@@ -0,0 +1,467 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "MultiShootGameMatchInstance.h"
+#include "EngineUtils.h"
+#include "MultiShootGamePlayerState.h"
+#include "GameFramework/GameModeBase.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/Character/MultiShootGameCharacter.h"
+#include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
+#include "MultiShootGame/Subsystem/EnemyProxySubsystem.h"
+#include "MultiShootGame/Subsystem/FrameBudgetSubsystem.h"
+#include "Net/UnrealNetwork.h"
+
+AMultiShootGameMatchInstance::AMultiShootGameMatchInstance()
+{
+	bReplicates = true;
+	bAlwaysRelevant = false;
+	bOnlyRelevantToOwner = false;
+	NetUpdateFrequency = 2.f;
+}
+
+void AMultiShootGameMatchInstance::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AMultiShootGameMatchInstance, InstanceId);
+	DOREPLIFETIME(AMultiShootGameMatchInstance, PlayerArray);
+	DOREPLIFETIME(AMultiShootGameMatchInstance, MatchElapsedTime);
+	DOREPLIFETIME(AMultiShootGameMatchInstance, WaveState);
+	DOREPLIFETIME(AMultiShootGameMatchInstance, WaveCount);
+}
+
+bool AMultiShootGameMatchInstance::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+                                                    const FVector& SrcLocation) const
+{
+	const APlayerController* PlayerController = Cast<APlayerController>(RealViewer);
+	if (PlayerController == nullptr)
+	{
+		return false;
+	}
+
+	const AMultiShootGamePlayerState* ViewerPlayerState = PlayerController->GetPlayerState<
+		AMultiShootGamePlayerState>();
+
+	return ViewerPlayerState && ViewerPlayerState->GetMatchInstanceId() == InstanceId;
+}
+
+void AMultiShootGameMatchInstance::InitializeMatch(int NewInstanceId, int NewMaxPlayers, FName NewBotSpawnTag)
+{
+	InstanceId = NewInstanceId;
+	MaxPlayers = FMath::Max(NewMaxPlayers, 1);
+	MatchElapsedTime = 0.f;
+	BotSpawnTag = NewBotSpawnTag;
+
+	BotSpawnPoints.Reset();
+	for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+	{
+		if (It->ActorHasTag(BotSpawnTag))
+		{
+			BotSpawnPoints.Add(*It);
+		}
+	}
+
+	if (BotClass && BotSpawnPoints.Num() == 0)
+	{
+		UE_LOG(LogMultiShootGame, Warning, TEXT("Match %d: no actors tagged %s, bots spawn at the world origin"),
+		       InstanceId, *BotSpawnTag.ToString());
+	}
+}
+
+bool AMultiShootGameMatchInstance::AddPlayer(AMultiShootGamePlayerState* NewPlayerState)
+{
+	if (NewPlayerState == nullptr || IsFull())
+	{
+		return false;
+	}
+
+	PlayerArray.AddUnique(NewPlayerState);
+	NewPlayerState->SetMatchInstance(this, InstanceId);
+
+	UE_LOG(LogMultiShootGame, Log, TEXT("Match %d: %s joined (%d/%d)"), InstanceId, *NewPlayerState->GetPlayerName(),
+	       PlayerArray.Num(), MaxPlayers);
+
+	// The first player starts the waves, later players join the running match
+	if (BotClass && WaveCount == 0 && !GetWorldTimerManager().IsTimerActive(TimerHandle_NextWaveStart))
+	{
+		PrepareForNextWave();
+	}
+
+	return true;
+}
+
+void AMultiShootGameMatchInstance::RemovePlayer(AMultiShootGamePlayerState* ExitingPlayerState)
+{
+	if (PlayerArray.Remove(ExitingPlayerState) > 0)
+	{
+		UE_LOG(LogMultiShootGame, Log, TEXT("Match %d: %s left (%d/%d)"), InstanceId,
+		       *ExitingPlayerState->GetPlayerName(), PlayerArray.Num(), MaxPlayers);
+	}
+
+	if (IsEmpty())
+	{
+		ResetMatch();
+	}
+}
+
+void AMultiShootGameMatchInstance::StartWave()
+{
+	WaveCount++;
+
+	NumberOfBotsToSpawn = BotsPerWave * WaveCount;
+
+	GetWorldTimerManager().SetTimer(TimerHandle_BotSpawner, this, &AMultiShootGameMatchInstance::SpawnBotTimerElapsed,
+	                                TimeBetweenBotSpawns, true, 0.0f);
+
+	WaveState = EWaveState::WaveInProgress;
+}
+
+void AMultiShootGameMatchInstance::EndWave()
+{
+	GetWorldTimerManager().ClearTimer(TimerHandle_BotSpawner);
+
+	WaveState = EWaveState::WaitingToComplete;
+}
+
+void AMultiShootGameMatchInstance::PrepareForNextWave()
+{
+	GetWorldTimerManager().SetTimer(TimerHandle_NextWaveStart, this, &AMultiShootGameMatchInstance::StartWave,
+	                                TimeBetweenWaves, false);
+
+	WaveState = EWaveState::WaitingToStart;
+
+	RespawnDeadPlayers();
+}
+
+void AMultiShootGameMatchInstance::SpawnBotTimerElapsed()
+{
+	const UFrameBudgetSubsystem* FrameBudgetSubsystem = GetWorld()->GetSubsystem<UFrameBudgetSubsystem>();
+	if (FrameBudgetSubsystem && FrameBudgetSubsystem->IsSpawnThrottled())
+	{
+		UE_LOG(LogMultiShootGame, Verbose, TEXT("Match %d: frame budget deferred a bot spawn (%d remaining)"),
+		       InstanceId, NumberOfBotsToSpawn);
+		return;
+	}
+
+	SpawnBot();
+
+	NumberOfBotsToSpawn--;
+
+	if (NumberOfBotsToSpawn <= 0)
+	{
+		EndWave();
+	}
+}
+
+void AMultiShootGameMatchInstance::SpawnBot()
+{
+	FTransform SpawnTransform = FTransform::Identity;
+	if (BotSpawnPoints.Num() > 0)
+	{
+		const AActor* SpawnPoint = BotSpawnPoints[FMath::RandHelper(BotSpawnPoints.Num())];
+		if (SpawnPoint)
+		{
+			SpawnTransform = SpawnPoint->GetActorTransform();
+		}
+	}
+
+	// Bots far from this match's players start as proxies and join the match once promoted
+	UEnemyProxySubsystem* EnemyProxySubsystem = GetWorld()->GetSubsystem<UEnemyProxySubsystem>();
+	if (EnemyProxySubsystem)
+	{
+		EnemyProxySubsystem->SpawnEnemy(BotClass, SpawnTransform.GetLocation(), SpawnTransform.Rotator(), this);
+		return;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride =
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	AMultiShootGameEnemyCharacter* Bot = GetWorld()->SpawnActor<AMultiShootGameEnemyCharacter>(
+		BotClass, SpawnTransform, SpawnParameters);
+	if (Bot == nullptr)
+	{
+		return;
+	}
+
+	if (Bot->GetController() == nullptr)
+	{
+		Bot->SpawnDefaultController();
+	}
+
+	AddBot(Bot);
+}
+
+void AMultiShootGameMatchInstance::AddBot(AMultiShootGameEnemyCharacter* Bot)
+{
+	if (Bot == nullptr || Bots.Contains(Bot))
+	{
+		return;
+	}
+
+	Bot->SetMatchInstance(this);
+
+	Bots.Add(Bot);
+	AddMatchPawn(Bot);
+}
+
+void AMultiShootGameMatchInstance::GameOver()
+{
+	EndWave();
+
+	WaveState = EWaveState::GameOver;
+
+	UE_LOG(LogMultiShootGame, Log, TEXT("Match %d: game over at wave %d"), InstanceId, WaveCount);
+}
+
+void AMultiShootGameMatchInstance::ResetMatch()
+{
+	GetWorldTimerManager().ClearTimer(TimerHandle_BotSpawner);
+	GetWorldTimerManager().ClearTimer(TimerHandle_NextWaveStart);
+
+	for (const TWeakObjectPtr<AMultiShootGameEnemyCharacter>& Bot : Bots)
+	{
+		if (Bot.IsValid())
+		{
+			Bot->Destroy();
+		}
+	}
+
+	Bots.Reset();
+	MatchPawns.Reset();
+
+	UEnemyProxySubsystem* EnemyProxySubsystem = GetWorld()->GetSubsystem<UEnemyProxySubsystem>();
+	if (EnemyProxySubsystem)
+	{
+		EnemyProxySubsystem->RemoveProxiesInMatch(this);
+	}
+
+	NumberOfBotsToSpawn = 0;
+	WaveCount = 0;
+	WaveState = EWaveState::WaitingToStart;
+	MatchElapsedTime = 0.f;
+}
+
+void AMultiShootGameMatchInstance::CheckWaveState()
+{
+	if (NumberOfBotsToSpawn > 0 || GetWorldTimerManager().IsTimerActive(TimerHandle_NextWaveStart))
+	{
+		return;
+	}
+
+	Bots.RemoveAll([](const TWeakObjectPtr<AMultiShootGameEnemyCharacter>& Bot)
+	{
+		return !Bot.IsValid() || Bot->GetHealthComponent()->bDied;
+	});
+
+	// Pooled actors stand in for nothing, the proxies of this match are its distant living bots
+	const UEnemyProxySubsystem* EnemyProxySubsystem = GetWorld()->GetSubsystem<UEnemyProxySubsystem>();
+
+	bool bIsAnyBotAlive = EnemyProxySubsystem && EnemyProxySubsystem->GetNumProxiesInMatch(this) > 0;
+	for (const TWeakObjectPtr<AMultiShootGameEnemyCharacter>& Bot : Bots)
+	{
+		if (!Bot->IsPooled())
+		{
+			bIsAnyBotAlive = true;
+			break;
+		}
+	}
+
+	if (!bIsAnyBotAlive)
+	{
+		WaveState = EWaveState::WaveComplete;
+
+		PrepareForNextWave();
+	}
+}
+
+void AMultiShootGameMatchInstance::CheckAnyPlayerAlive()
+{
+	bool bAnyPlayerPawn = false;
+	for (const AMultiShootGamePlayerState* TempPlayerState : PlayerArray)
+	{
+		const AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(TempPlayerState->GetPawn());
+		if (Character == nullptr)
+		{
+			continue;
+		}
+
+		if (!Character->GetHealthComponent()->bDied)
+		{
+			return;
+		}
+
+		bAnyPlayerPawn = true;
+	}
+
+	// Players that have not spawned yet are not dead
+	if (bAnyPlayerPawn)
+	{
+		GameOver();
+	}
+}
+
+void AMultiShootGameMatchInstance::RespawnDeadPlayers()
+{
+	AGameModeBase* GameMode = GetWorld()->GetAuthGameMode();
+	if (GameMode == nullptr)
+	{
+		return;
+	}
+
+	for (const AMultiShootGamePlayerState* TempPlayerState : PlayerArray)
+	{
+		AController* Controller = Cast<AController>(TempPlayerState->GetOwner());
+		if (Controller && Controller->GetPawn() == nullptr)
+		{
+			GameMode->RestartPlayer(Controller);
+		}
+	}
+}
+
+void AMultiShootGameMatchInstance::RefreshMatchPawns()
+{
+	MatchPawns.RemoveAll([](const TWeakObjectPtr<APawn>& Pawn)
+	{
+		return !Pawn.IsValid();
+	});
+
+	// Respawned players get a new pawn, which is picked up here
+	for (const AMultiShootGamePlayerState* TempPlayerState : PlayerArray)
+	{
+		APawn* Pawn = TempPlayerState->GetPawn();
+		if (Pawn && !MatchPawns.Contains(Pawn))
+		{
+			AddMatchPawn(Pawn);
+		}
+	}
+}
+
+void AMultiShootGameMatchInstance::AddMatchPawn(APawn* Pawn)
+{
+	UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Pawn->GetRootComponent());
+	if (PrimitiveComponent == nullptr)
+	{
+		return;
+	}
+
+	for (TActorIterator<AMultiShootGameMatchInstance> It(GetWorld()); It; ++It)
+	{
+		if (*It == this)
+		{
+			continue;
+		}
+
+		for (const TWeakObjectPtr<APawn>& OtherPawn : It->MatchPawns)
+		{
+			UPrimitiveComponent* OtherPrimitiveComponent = OtherPawn.IsValid()
+				                                               ? Cast<UPrimitiveComponent>(
+					                                               OtherPawn->GetRootComponent())
+				                                               : nullptr;
+			if (OtherPrimitiveComponent)
+			{
+				PrimitiveComponent->MoveIgnoreActors.AddUnique(OtherPawn.Get());
+				OtherPrimitiveComponent->MoveIgnoreActors.AddUnique(Pawn);
+			}
+		}
+	}
+
+	MatchPawns.Add(Pawn);
+}
+
+void AMultiShootGameMatchInstance::IgnoreOtherMatches(const AActor* Actor, UPrimitiveComponent* PrimitiveComponent)
+{
+	const int MatchInstanceId = AMultiShootGamePlayerState::FindMatchInstanceId(Actor);
+	if (PrimitiveComponent == nullptr || MatchInstanceId == INDEX_NONE)
+	{
+		return;
+	}
+
+	for (TActorIterator<AMultiShootGameMatchInstance> It(Actor->GetWorld()); It; ++It)
+	{
+		if (It->InstanceId == MatchInstanceId)
+		{
+			continue;
+		}
+
+		for (const TWeakObjectPtr<APawn>& OtherPawn : It->MatchPawns)
+		{
+			if (OtherPawn.IsValid())
+			{
+				PrimitiveComponent->MoveIgnoreActors.AddUnique(OtherPawn.Get());
+			}
+		}
+	}
+}
+
+void AMultiShootGameMatchInstance::IgnoreOtherMatches(const AActor* Actor, FCollisionQueryParams& QueryParams)
+{
+	const int MatchInstanceId = AMultiShootGamePlayerState::FindMatchInstanceId(Actor);
+	if (MatchInstanceId == INDEX_NONE)
+	{
+		return;
+	}
+
+	for (TActorIterator<AMultiShootGameMatchInstance> It(Actor->GetWorld()); It; ++It)
+	{
+		if (It->InstanceId == MatchInstanceId)
+		{
+			continue;
+		}
+
+		for (const TWeakObjectPtr<APawn>& OtherPawn : It->MatchPawns)
+		{
+			if (OtherPawn.IsValid())
+			{
+				QueryParams.AddIgnoredActor(OtherPawn.Get());
+			}
+		}
+	}
+}
+
+void AMultiShootGameMatchInstance::TickMatch(float DeltaSeconds)
+{
+	PlayerArray.RemoveAll([](const AMultiShootGamePlayerState* TempPlayerState)
+	{
+		return !IsValid(TempPlayerState);
+	});
+
+	if (IsEmpty())
+	{
+		return;
+	}
+
+	MatchElapsedTime += DeltaSeconds;
+
+	RefreshMatchPawns();
+
+	if (BotClass && WaveState != EWaveState::GameOver)
+	{
+		CheckWaveState();
+
+		CheckAnyPlayerAlive();
+	}
+
+	CurrentFrameTimeLog += DeltaSeconds;
+	if (CurrentFrameTimeLog >= FrameTimeLogInterval)
+	{
+		CurrentFrameTimeLog = 0.f;
+
+		UE_LOG(LogMultiShootGame, Log, TEXT("Match %d: %d players, %d bots, frame time avg %.3f ms, peak %.3f ms"),
+		       InstanceId, PlayerArray.Num(), Bots.Num(), GetAverageFrameTimeMs(), GetPeakFrameTimeMs());
+
+		PeakFrameTime = 0.0;
+	}
+}
+
+void AMultiShootGameMatchInstance::AddFrameTime(double Seconds)
+{
+	CurrentFrameTime += Seconds;
+}
+
+void AMultiShootGameMatchInstance::EndFrame()
+{
+	AverageFrameTime = FMath::Lerp(AverageFrameTime, CurrentFrameTime, 0.05);
+	PeakFrameTime = FMath::Max(PeakFrameTime, CurrentFrameTime);
+	CurrentFrameTime = 0.0;
+}
@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "MultiShootGame/Enum/EWaveState.h"
+#include "MultiShootGameMatchInstance.generated.h"
+
+class AMultiShootGameEnemyCharacter;
+class AMultiShootGamePlayerState;
+
+/**
+ * One isolated match hosted by AMultiShootGameServerGameMode. Acts as the per-match game state: it is only
+ * replicated to its own players and runs its own bot waves, player list and frame-time accounting. Pawns of
+ * different instances ignore each other's movement and projectiles, so matches can share one level.
+ */
+UCLASS()
+class MULTISHOOTGAME_API AMultiShootGameMatchInstance : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+	AMultiShootGameMatchInstance();
+
+protected:
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = MatchInstance)
+	int InstanceId = INDEX_NONE;
+
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = MatchInstance)
+	TArray<AMultiShootGamePlayerState*> PlayerArray;
+
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = MatchInstance)
+	float MatchElapsedTime = 0.f;
+
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = MatchInstance)
+	EWaveState WaveState = EWaveState::WaitingToStart;
+
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = MatchInstance)
+	int WaveCount = 0;
+
+	/** Bot spawned by this match's waves. Without one the match is player versus player only. */
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	TSubclassOf<AMultiShootGameEnemyCharacter> BotClass;
+
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	int BotsPerWave = 2;
+
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	float TimeBetweenWaves = 2.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	float TimeBetweenBotSpawns = 1.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	float FrameTimeLogInterval = 30.f;
+
+	int MaxPlayers = 4;
+
+	/** Actors tagged with this name are the bot spawn points of this match. */
+	FName BotSpawnTag;
+
+	UPROPERTY()
+	TArray<AActor*> BotSpawnPoints;
+
+	TArray<TWeakObjectPtr<AMultiShootGameEnemyCharacter>> Bots;
+
+	/** Player pawns and bots of this match, already excluded from the collision of every other match. */
+	TArray<TWeakObjectPtr<APawn>> MatchPawns;
+
+	int NumberOfBotsToSpawn = 0;
+
+	FTimerHandle TimerHandle_BotSpawner;
+
+	FTimerHandle TimerHandle_NextWaveStart;
+
+	double CurrentFrameTime = 0.0;
+
+	double AverageFrameTime = 0.0;
+
+	double PeakFrameTime = 0.0;
+
+	float CurrentFrameTimeLog = 0.f;
+
+	void StartWave();
+
+	void EndWave();
+
+	void PrepareForNextWave();
+
+	void SpawnBotTimerElapsed();
+
+	void SpawnBot();
+
+	void GameOver();
+
+	void ResetMatch();
+
+	void CheckWaveState();
+
+	void CheckAnyPlayerAlive();
+
+	void RespawnDeadPlayers();
+
+	void RefreshMatchPawns();
+
+	void AddMatchPawn(APawn* Pawn);
+
+public:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+	                              const FVector& SrcLocation) const override;
+
+	void InitializeMatch(int NewInstanceId, int NewMaxPlayers, FName NewBotSpawnTag);
+
+	bool AddPlayer(AMultiShootGamePlayerState* NewPlayerState);
+
+	void RemovePlayer(AMultiShootGamePlayerState* ExitingPlayerState);
+
+	/** Adds a bot to this match, wherever it was spawned. */
+	void AddBot(AMultiShootGameEnemyCharacter* Bot);
+
+	void TickMatch(float DeltaSeconds);
+
+	void AddFrameTime(double Seconds);
+
+	/** Closes the frame once every actor has ticked, so it holds the whole frame of this match. */
+	void EndFrame();
+
+	/** Keeps a projectile or trace of one match from colliding with the pawns of every other match. */
+	static void IgnoreOtherMatches(const AActor* Actor, UPrimitiveComponent* PrimitiveComponent);
+
+	static void IgnoreOtherMatches(const AActor* Actor, FCollisionQueryParams& QueryParams);
+
+	FORCEINLINE bool IsFull() const { return PlayerArray.Num() >= MaxPlayers; }
+
+	FORCEINLINE bool IsEmpty() const { return PlayerArray.Num() == 0; }
+
+	UFUNCTION(BlueprintPure, Category = MatchInstance)
+	FORCEINLINE int GetInstanceId() const { return InstanceId; }
+
+	UFUNCTION(BlueprintPure, Category = MatchInstance)
+	FORCEINLINE int GetNumPlayers() const { return PlayerArray.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = MatchInstance)
+	FORCEINLINE EWaveState GetWaveState() const { return WaveState; }
+
+	UFUNCTION(BlueprintPure, Category = MatchInstance)
+	FORCEINLINE int GetWaveCount() const { return WaveCount; }
+
+	UFUNCTION(BlueprintPure, Category = MatchInstance)
+	FORCEINLINE float GetAverageFrameTimeMs() const { return AverageFrameTime * 1000.0; }
+
+	UFUNCTION(BlueprintPure, Category = MatchInstance)
+	FORCEINLINE float GetPeakFrameTimeMs() const { return PeakFrameTime * 1000.0; }
+};
@@ -1,6 +1,8 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "MultiShootGamePlayerState.h"
+#include "MultiShootGameMatchInstance.h"
+#include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
 #include "Net/UnrealNetwork.h"
 
 void AMultiShootGamePlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -12,6 +14,20 @@ void AMultiShootGamePlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProp
 	DOREPLIFETIME(AMultiShootGamePlayerState, MainWeaponMesh);
 	DOREPLIFETIME(AMultiShootGamePlayerState, SecondWeaponMesh);
 	DOREPLIFETIME(AMultiShootGamePlayerState, ThirdWeaponMesh);
+	DOREPLIFETIME(AMultiShootGamePlayerState, MatchInstanceId);
+	DOREPLIFETIME(AMultiShootGamePlayerState, MatchInstance);
+}
+
+bool AMultiShootGamePlayerState::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+                                                  const FVector& SrcLocation) const
+{
+	// Player states are always relevant, so the match check has to come before the engine's
+	if (MatchInstanceId != INDEX_NONE && !IsSameMatch(this, RealViewer))
+	{
+		return false;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
 }
 
 void AMultiShootGamePlayerState::SetMainWeaponMesh_Server_Implementation(USkeletalMesh* WeaponMesh)
@@ -43,3 +59,92 @@ void AMultiShootGamePlayerState::AddDeath_Server_Implementation(int Num)
 {
 	Death += Num;
 }
+
+void AMultiShootGamePlayerState::SetMatchInstance(AMultiShootGameMatchInstance* NewMatchInstance,
+                                                  int NewMatchInstanceId)
+{
+	MatchInstance = NewMatchInstance;
+	MatchInstanceId = NewMatchInstanceId;
+}
+
+const AMultiShootGamePlayerState* AMultiShootGamePlayerState::FindPlayerState(const AActor* Actor)
+{
+	if (const AMultiShootGamePlayerState* TempPlayerState = Cast<AMultiShootGamePlayerState>(Actor))
+	{
+		return TempPlayerState;
+	}
+
+	if (const APawn* Pawn = Cast<APawn>(Actor))
+	{
+		return Pawn->GetPlayerState<AMultiShootGamePlayerState>();
+	}
+
+	if (const AController* Controller = Cast<AController>(Actor))
+	{
+		return Controller->GetPlayerState<AMultiShootGamePlayerState>();
+	}
+
+	if (Actor == nullptr)
+	{
+		return nullptr;
+	}
+
+	// Projectiles, grenades and damage actors take the match of whoever fired them
+	const APawn* InstigatorPawn = Actor->GetInstigator();
+	if (InstigatorPawn && InstigatorPawn != Actor)
+	{
+		return FindPlayerState(InstigatorPawn);
+	}
+
+	return FindPlayerState(Actor->GetOwner());
+}
+
+int AMultiShootGamePlayerState::FindMatchInstanceId(const AActor* Actor)
+{
+	if (Actor == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const AMultiShootGameEnemyCharacter* EnemyCharacter = Cast<AMultiShootGameEnemyCharacter>(Actor))
+	{
+		return EnemyCharacter->GetMatchInstanceId();
+	}
+
+	if (const AMultiShootGameMatchInstance* TempMatchInstance = Cast<AMultiShootGameMatchInstance>(Actor))
+	{
+		return TempMatchInstance->GetInstanceId();
+	}
+
+	if (Cast<AMultiShootGamePlayerState>(Actor) || Cast<APawn>(Actor))
+	{
+		const AMultiShootGamePlayerState* TempPlayerState = FindPlayerState(Actor);
+
+		return TempPlayerState ? TempPlayerState->MatchInstanceId : INDEX_NONE;
+	}
+
+	// Bot controllers have no player state, their pawn carries the match
+	if (const AController* Controller = Cast<AController>(Actor))
+	{
+		const AMultiShootGamePlayerState* TempPlayerState = Controller->GetPlayerState<AMultiShootGamePlayerState>();
+
+		return TempPlayerState ? TempPlayerState->MatchInstanceId : FindMatchInstanceId(Controller->GetPawn());
+	}
+
+	// Projectiles, grenades, weapons and damage actors take the match of whoever fired or carries them
+	const APawn* InstigatorPawn = Actor->GetInstigator();
+	if (InstigatorPawn && InstigatorPawn != Actor)
+	{
+		return FindMatchInstanceId(InstigatorPawn);
+	}
+
+	return FindMatchInstanceId(Actor->GetOwner());
+}
+
+bool AMultiShootGamePlayerState::IsSameMatch(const AActor* ActorA, const AActor* ActorB)
+{
+	const int MatchInstanceIdA = FindMatchInstanceId(ActorA);
+	const int MatchInstanceIdB = FindMatchInstanceId(ActorB);
+
+	return MatchInstanceIdA == INDEX_NONE || MatchInstanceIdB == INDEX_NONE || MatchInstanceIdA == MatchInstanceIdB;
+}
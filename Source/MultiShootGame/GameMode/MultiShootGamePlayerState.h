@@ -7,6 +7,8 @@
 #include "MultiShootGame/Struct/WeaponInfo.h"
 #include "MultiShootGamePlayerState.generated.h"
 
+class AMultiShootGameMatchInstance;
+
 /**
  * 
  */
@@ -31,9 +33,18 @@ protected:
 	UPROPERTY(Replicated)
 	USkeletalMesh* ThirdWeaponMesh;
 
+	UPROPERTY(Replicated)
+	int MatchInstanceId = INDEX_NONE;
+
+	UPROPERTY(Replicated)
+	AMultiShootGameMatchInstance* MatchInstance;
+
 public:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+	                              const FVector& SrcLocation) const override;
+
 	UFUNCTION(Server, Reliable, Category = PlayerState)
 	void SetMainWeaponMesh_Server(USkeletalMesh* WeaponMesh);
 
@@ -66,4 +77,22 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = PlayerState)
 	FORCEINLINE USkeletalMesh* GetThirdWeaponMesh() const { return ThirdWeaponMesh; }
+
+	void SetMatchInstance(AMultiShootGameMatchInstance* NewMatchInstance, int NewMatchInstanceId);
+
+	UFUNCTION(BlueprintPure, Category = PlayerState)
+	FORCEINLINE int GetMatchInstanceId() const { return MatchInstanceId; }
+
+	FORCEINLINE AMultiShootGameMatchInstance* GetMatchInstance() const { return MatchInstance; }
+
+	static const AMultiShootGamePlayerState* FindPlayerState(const AActor* Actor);
+
+	/**
+	 * Players and bots carry a match id, and other actors such as projectiles, grenades and weapons inherit it from
+	 * their instigator or owner. Returns INDEX_NONE for actors of no match.
+	 */
+	static int FindMatchInstanceId(const AActor* Actor);
+
+	/** Actors of no match, such as everything in a single-match game mode, belong to every match. */
+	static bool IsSameMatch(const AActor* ActorA, const AActor* ActorB);
 };
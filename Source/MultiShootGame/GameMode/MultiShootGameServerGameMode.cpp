@@ -2,12 +2,176 @@
 
 
 #include "MultiShootGameServerGameMode.h"
+#include "EngineUtils.h"
+#include "MultiShootGameMatchInstance.h"
+#include "MultiShootGamePlayerState.h"
+#include "GameFramework/PlayerStart.h"
+#include "MultiShootGame/MultiShootGame.h"
 
 AMultiShootGameServerGameMode::AMultiShootGameServerGameMode(): Super()
 {
+	PrimaryActorTick.bCanEverTick = true;
+
+	MatchInstanceClass = AMultiShootGameMatchInstance::StaticClass();
 }
 
 void AMultiShootGameServerGameMode::StartPlay()
 {
 	Super::StartPlay();
 }
+
+void AMultiShootGameServerGameMode::BeginPlay()
+{
+	Super::BeginPlay();
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+		this, &AMultiShootGameServerGameMode::OnWorldPostActorTick);
+}
+
+void AMultiShootGameServerGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+AMultiShootGameMatchInstance* AMultiShootGameServerGameMode::FindOrCreateMatchInstance()
+{
+	// Fill the busiest instance that still has room so matches start with as many players as possible
+	AMultiShootGameMatchInstance* BestMatchInstance = nullptr;
+	for (AMultiShootGameMatchInstance* MatchInstance : MatchInstances)
+	{
+		if (MatchInstance && !MatchInstance->IsFull() &&
+			(BestMatchInstance == nullptr || MatchInstance->GetNumPlayers() > BestMatchInstance->GetNumPlayers()))
+		{
+			BestMatchInstance = MatchInstance;
+		}
+	}
+
+	if (BestMatchInstance || MatchInstances.Num() >= MaxMatchInstances)
+	{
+		return BestMatchInstance;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Owner = this;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AMultiShootGameMatchInstance* NewMatchInstance = GetWorld()->SpawnActor<AMultiShootGameMatchInstance>(
+		MatchInstanceClass, FTransform::Identity, SpawnParameters);
+	if (NewMatchInstance)
+	{
+		const FName BotSpawnTag = *FString::Printf(TEXT("%s%d%s"), *MatchPlayerStartPrefix, MatchInstances.Num(),
+		                                           *MatchBotSpawnSuffix);
+
+		NewMatchInstance->InitializeMatch(MatchInstances.Num(), MaxPlayersPerMatch, BotSpawnTag);
+		MatchInstances.Add(NewMatchInstance);
+
+		UE_LOG(LogMultiShootGame, Log, TEXT("Created match instance %d (%d/%d)"), NewMatchInstance->GetInstanceId(),
+		       MatchInstances.Num(), MaxMatchInstances);
+	}
+
+	return NewMatchInstance;
+}
+
+AActor* AMultiShootGameServerGameMode::ChoosePlayerStart_Implementation(AController* Player)
+{
+	const AMultiShootGamePlayerState* TempPlayerState = Player
+		                                                    ? Player->GetPlayerState<AMultiShootGamePlayerState>()
+		                                                    : nullptr;
+	if (TempPlayerState && TempPlayerState->GetMatchInstanceId() != INDEX_NONE)
+	{
+		const FName MatchTag = *FString::Printf(TEXT("%s%d"), *MatchPlayerStartPrefix,
+		                                        TempPlayerState->GetMatchInstanceId());
+
+		TArray<APlayerStart*> PlayerStarts;
+		for (TActorIterator<APlayerStart> It(GetWorld()); It; ++It)
+		{
+			if (It->PlayerStartTag == MatchTag)
+			{
+				PlayerStarts.Add(*It);
+			}
+		}
+
+		if (PlayerStarts.Num() > 0)
+		{
+			return PlayerStarts[FMath::RandHelper(PlayerStarts.Num())];
+		}
+	}
+
+	return Super::ChoosePlayerStart_Implementation(Player);
+}
+
+void AMultiShootGameServerGameMode::PostLogin(APlayerController* NewPlayer)
+{
+	// Assign the match before the first pawn is spawned so ChoosePlayerStart can use the instance spawn area
+	AMultiShootGamePlayerState* NewPlayerState = NewPlayer
+		                                             ? NewPlayer->GetPlayerState<AMultiShootGamePlayerState>()
+		                                             : nullptr;
+	if (NewPlayerState)
+	{
+		AMultiShootGameMatchInstance* MatchInstance = FindOrCreateMatchInstance();
+		if (MatchInstance == nullptr || !MatchInstance->AddPlayer(NewPlayerState))
+		{
+			UE_LOG(LogMultiShootGame, Warning, TEXT("No free match instance for %s"),
+			       *NewPlayerState->GetPlayerName());
+		}
+	}
+
+	Super::PostLogin(NewPlayer);
+}
+
+void AMultiShootGameServerGameMode::Logout(AController* Exiting)
+{
+	AMultiShootGamePlayerState* ExitingPlayerState = Exiting
+		                                                 ? Exiting->GetPlayerState<AMultiShootGamePlayerState>()
+		                                                 : nullptr;
+	if (ExitingPlayerState && ExitingPlayerState->GetMatchInstance())
+	{
+		ExitingPlayerState->GetMatchInstance()->RemovePlayer(ExitingPlayerState);
+		ExitingPlayerState->SetMatchInstance(nullptr, INDEX_NONE);
+	}
+
+	Super::Logout(Exiting);
+}
+
+void AMultiShootGameServerGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	for (AMultiShootGameMatchInstance* MatchInstance : MatchInstances)
+	{
+		if (MatchInstance == nullptr)
+		{
+			continue;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		MatchInstance->TickMatch(DeltaSeconds);
+
+		MatchInstance->AddFrameTime(FPlatformTime::Seconds() - StartTime);
+	}
+}
+
+void AMultiShootGameServerGameMode::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	// Players and bots report their own tick cost into the instance, so the frame closes after every actor ticked
+	for (AMultiShootGameMatchInstance* MatchInstance : MatchInstances)
+	{
+		if (MatchInstance)
+		{
+			MatchInstance->EndFrame();
+		}
+	}
+}
+
+AMultiShootGameMatchInstance* AMultiShootGameServerGameMode::GetMatchInstance(int InstanceId) const
+{
+	return MatchInstances.IsValidIndex(InstanceId) ? MatchInstances[InstanceId] : nullptr;
+}
@@ -6,6 +6,8 @@
 #include "GameFramework/GameMode.h"
 #include "MultiShootGameServerGameMode.generated.h"
 
+class AMultiShootGameMatchInstance;
+
 /**
  * 
  */
@@ -18,4 +20,46 @@ public:
 	AMultiShootGameServerGameMode();
 
 	virtual void StartPlay() override;
+
+protected:
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	TSubclassOf<AMultiShootGameMatchInstance> MatchInstanceClass;
+
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	int MaxMatchInstances = 4;
+
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	int MaxPlayersPerMatch = 4;
+
+	/** Player starts tagged "Match0", "Match1"... and bot spawn points tagged "Match0Bot"... belong to one match. */
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	FString MatchPlayerStartPrefix = TEXT("Match");
+
+	UPROPERTY(EditDefaultsOnly, Category = MatchInstance)
+	FString MatchBotSpawnSuffix = TEXT("Bot");
+
+	UPROPERTY()
+	TArray<AMultiShootGameMatchInstance*> MatchInstances;
+
+	FDelegateHandle PostActorTickHandle;
+
+	AMultiShootGameMatchInstance* FindOrCreateMatchInstance();
+
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	virtual AActor* ChoosePlayerStart_Implementation(AController* Player) override;
+
+public:
+	virtual void PostLogin(APlayerController* NewPlayer) override;
+
+	virtual void Logout(AController* Exiting) override;
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	UFUNCTION(BlueprintPure, Category = MatchInstance)
+	AMultiShootGameMatchInstance* GetMatchInstance(int InstanceId) const;
 };
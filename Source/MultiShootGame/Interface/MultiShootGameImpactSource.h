@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "MultiShootGameImpactSource.generated.h"
+
+class UHitEffectComponent;
+
+UINTERFACE(MinimalAPI)
+class UMultiShootGameImpactSource : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Anything that causes bullet impacts. Clients read these from the class defaults to play impact events sent by
+ * the server, so they must not depend on instance state.
+ */
+class MULTISHOOTGAME_API IMultiShootGameImpactSource
+{
+	GENERATED_BODY()
+
+public:
+	virtual const UHitEffectComponent* GetImpactHitEffect() const = 0;
+
+	virtual UMaterialInterface* GetImpactDecalMaterial() const { return nullptr; }
+
+	virtual FVector GetImpactDecalSize() const { return FVector::ZeroVector; }
+};
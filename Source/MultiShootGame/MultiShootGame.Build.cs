@@ -10,7 +10,7 @@ public class MultiShootGame : ModuleRules
 
 		PublicDependencyModuleNames.AddRange(new string[]
 		{
-			"Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "UMG", "AIModule", "AnimGraphRuntime", "PhysicsCore", "GameplayCameras", "GameplayTasks" 
+			"Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "UMG", "AIModule", "AnimGraphRuntime", "PhysicsCore", "GameplayCameras", "GameplayTasks", "NavigationSystem" 
 		});
 	}
 }
\ No newline at end of file
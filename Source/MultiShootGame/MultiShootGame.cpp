@@ -3,5 +3,7 @@
 #include "MultiShootGame.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogMultiShootGame);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, MultiShootGame, "MultiShootGame" );
  
\ No newline at end of file
@@ -4,6 +4,10 @@
 
 #include "CoreMinimal.h"
 
+DECLARE_LOG_CATEGORY_EXTERN(LogMultiShootGame, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("MultiShootGame"), STATGROUP_MultiShootGame, STATCAT_Advanced);
+
 #define SURFACE_CHARACTER SurfaceType1
 #define SURFACE_HEAD SurfaceType2
 #define SURFACE_STONE SurfaceType3
@@ -2,7 +2,6 @@
 
 
 #include "ImpactParticleSystem.h"
-#include "Kismet/GameplayStatics.h"
 #include "Particles/ParticleSystemComponent.h"
 
 // Sets default values
@@ -12,18 +11,12 @@ AImpactParticleSystem::AImpactParticleSystem()
 	PrimaryActorTick.bCanEverTick = true;
 
 	ParticleSystemComponent = CreateDefaultSubobject<UParticleSystemComponent>(TEXT("ParticleSystemComponent"));
-	ParticleSystemComponent->OnParticleCollide.AddDynamic(this, &AImpactParticleSystem::OnParticleCollide);
 	RootComponent = ParticleSystemComponent;
 
 	InitialLifeSpan = 3.f;
 }
 
-void AImpactParticleSystem::OnParticleCollide(FName EventName, float EmitterTime, int32 ParticleTime,
-                                              FVector Location, FVector Velocity, FVector Direction,
-                                              FVector Normal, FName BoneName, UPhysicalMaterial* PhysMat)
+UParticleSystem* AImpactParticleSystem::GetParticleTemplate() const
 {
-	if (DecalMaterial)
-	{
-		UGameplayStatics::SpawnDecalAtLocation(GetWorld(), DecalMaterial, DecalSize, Location, Normal.Rotation(), 10.f);
-	}
+	return ParticleSystemComponent->Template;
 }
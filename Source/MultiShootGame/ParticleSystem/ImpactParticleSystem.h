@@ -25,7 +25,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Impact)
 	FVector DecalSize;
 
-	UFUNCTION()
-	void OnParticleCollide(FName EventName, float EmitterTime, int32 ParticleTime, FVector Location, FVector Velocity,
-	                       FVector Direction, FVector Normal, FName BoneName, UPhysicalMaterial* PhysMat);
+public:
+	UParticleSystem* GetParticleTemplate() const;
+
+	FORCEINLINE UMaterialInterface* GetDecalMaterial() const { return DecalMaterial; }
+
+	FORCEINLINE FVector GetDecalSize() const { return DecalSize; }
 };
@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ParticleSystemPool.h"
+#include "GameFramework/WorldSettings.h"
+#include "MultiShootGame/Subsystem/DecalManagerSubsystem.h"
+#include "Particles/ParticleSystemComponent.h"
+
+void UParticleSystemPool::InitializePool(UParticleSystem* NewTemplate, int NewMaxActive, int NumPrewarm)
+{
+	Template = NewTemplate;
+	MaxActive = FMath::Max(NewMaxActive, 1);
+
+	for (int i = 0; i < FMath::Min(NumPrewarm, MaxActive); i++)
+	{
+		UParticleSystemComponent* Component = CreateComponent();
+		if (Component)
+		{
+			FreeComponents.Add(Component);
+		}
+	}
+}
+
+void UParticleSystemPool::SetCollisionDecal(UMaterialInterface* DecalMaterial, FVector DecalSize)
+{
+	CollisionDecalMaterial = DecalMaterial;
+	CollisionDecalSize = DecalSize;
+}
+
+UParticleSystemComponent* UParticleSystemPool::CreateComponent()
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr || Template == nullptr)
+	{
+		return nullptr;
+	}
+
+	UParticleSystemComponent* Component = NewObject<UParticleSystemComponent>(World->GetWorldSettings());
+	Component->bAutoActivate = false;
+	Component->bAutoDestroy = false;
+	Component->bAutoManageAttachment = false;
+	Component->SetTemplate(Template);
+	Component->OnSystemFinished.AddDynamic(this, &UParticleSystemPool::OnSystemFinished);
+	Component->OnParticleCollide.AddDynamic(this, &UParticleSystemPool::OnParticleCollide);
+	Component->RegisterComponentWithWorld(World);
+
+	return Component;
+}
+
+UParticleSystemComponent* UParticleSystemPool::Play(FVector Location, FRotator Rotation)
+{
+	UParticleSystemComponent* Component = nullptr;
+
+	if (FreeComponents.Num() > 0)
+	{
+		Component = FreeComponents.Pop(false);
+	}
+	else if (ActiveComponents.Num() < MaxActive)
+	{
+		Component = CreateComponent();
+	}
+	else
+	{
+		Component = ActiveComponents[0];
+		ActiveComponents.RemoveAt(0, 1, false);
+		Component->KillParticlesForced();
+
+		NumStolen++;
+	}
+
+	if (Component == nullptr)
+	{
+		return nullptr;
+	}
+
+	Component->SetWorldLocationAndRotation(Location, Rotation);
+	Component->ActivateSystem(true);
+	ActiveComponents.Add(Component);
+
+	return Component;
+}
+
+void UParticleSystemPool::ReleaseAll()
+{
+	// Deactivating broadcasts OnSystemFinished, which must not touch the list being iterated
+	TArray<UParticleSystemComponent*> ReleasedComponents = MoveTemp(ActiveComponents);
+	ActiveComponents.Reset();
+
+	for (UParticleSystemComponent* Component : ReleasedComponents)
+	{
+		Component->DeactivateImmediate();
+	}
+
+	FreeComponents.Append(ReleasedComponents);
+}
+
+void UParticleSystemPool::OnSystemFinished(UParticleSystemComponent* FinishedComponent)
+{
+	if (ActiveComponents.Remove(FinishedComponent) > 0)
+	{
+		FreeComponents.Add(FinishedComponent);
+	}
+}
+
+void UParticleSystemPool::OnParticleCollide(FName EventName, float EmitterTime, int32 ParticleTime, FVector Location,
+                                            FVector Velocity, FVector Direction, FVector Normal, FName BoneName,
+                                            UPhysicalMaterial* PhysMat)
+{
+	if (CollisionDecalMaterial)
+	{
+		UDecalManagerSubsystem::SpawnDecal(this, CollisionDecalMaterial, CollisionDecalSize, Location,
+		                                   Normal.Rotation());
+	}
+}
@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "ParticleSystemPool.generated.h"
+
+class UParticleSystem;
+class UParticleSystemComponent;
+
+/**
+ * Fixed set of reusable emitter components for one particle template. Finished components go back to the free
+ * list; when MaxActive components are playing, the oldest one is stolen and restarted.
+ */
+UCLASS()
+class MULTISHOOTGAME_API UParticleSystemPool : public UObject
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY()
+	UParticleSystem* Template;
+
+	UPROPERTY()
+	UMaterialInterface* CollisionDecalMaterial;
+
+	FVector CollisionDecalSize = FVector::ZeroVector;
+
+	int MaxActive = 16;
+
+	/** Playing components, oldest first. */
+	UPROPERTY()
+	TArray<UParticleSystemComponent*> ActiveComponents;
+
+	UPROPERTY()
+	TArray<UParticleSystemComponent*> FreeComponents;
+
+	int NumStolen = 0;
+
+	UParticleSystemComponent* CreateComponent();
+
+	UFUNCTION()
+	void OnSystemFinished(UParticleSystemComponent* FinishedComponent);
+
+	UFUNCTION()
+	void OnParticleCollide(FName EventName, float EmitterTime, int32 ParticleTime, FVector Location, FVector Velocity,
+	                       FVector Direction, FVector Normal, FName BoneName, UPhysicalMaterial* PhysMat);
+
+public:
+	void InitializePool(UParticleSystem* NewTemplate, int NewMaxActive, int NumPrewarm);
+
+	void SetCollisionDecal(UMaterialInterface* DecalMaterial, FVector DecalSize);
+
+	UParticleSystemComponent* Play(FVector Location, FRotator Rotation);
+
+	void ReleaseAll();
+
+	FORCEINLINE UParticleSystem* GetTemplate() const { return Template; }
+
+	FORCEINLINE int GetNumActive() const { return ActiveComponents.Num(); }
+
+	FORCEINLINE int GetNumFree() const { return FreeComponents.Num(); }
+
+	FORCEINLINE int GetNumStolen() const { return NumStolen; }
+};
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "HitZone.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+
+TMap<TObjectKey<UPhysicsAsset>, TArray<TSharedPtr<const FHitZoneTable>>> FHitZoneTable::Tables;
+
+TSharedPtr<const FHitZoneTable> FHitZoneTable::FindOrBuild(const USkeletalMeshComponent* MeshComponent,
+                                                           const TArray<FHitZone>& HitZones)
+{
+	UPhysicsAsset* PhysicsAsset = MeshComponent ? MeshComponent->GetPhysicsAsset() : nullptr;
+	const USkeletalMesh* SkeletalMesh = MeshComponent ? MeshComponent->SkeletalMesh : nullptr;
+	if (PhysicsAsset == nullptr || SkeletalMesh == nullptr)
+	{
+		return nullptr;
+	}
+
+	TArray<TSharedPtr<const FHitZoneTable>>& AssetTables = Tables.FindOrAdd(PhysicsAsset);
+	const TSharedPtr<const FHitZoneTable>* ExistingTable = AssetTables.FindByPredicate(
+		[&HitZones](const TSharedPtr<const FHitZoneTable>& TempTable)
+		{
+			return TempTable->SourceZones == HitZones;
+		});
+
+	if (ExistingTable)
+	{
+		return *ExistingTable;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+
+	TSharedPtr<FHitZoneTable> Table = MakeShared<FHitZoneTable>();
+	Table->BodyZones.SetNum(PhysicsAsset->SkeletalBodySetups.Num());
+	Table->SourceZones = HitZones;
+
+	// A body takes the zone of its own bone or of the closest ancestor that has one
+	for (int BodyIndex = 0; BodyIndex < PhysicsAsset->SkeletalBodySetups.Num(); BodyIndex++)
+	{
+		const USkeletalBodySetup* BodySetup = PhysicsAsset->SkeletalBodySetups[BodyIndex];
+		int32 BoneIndex = BodySetup ? RefSkeleton.FindBoneIndex(BodySetup->BoneName) : INDEX_NONE;
+
+		while (BoneIndex != INDEX_NONE)
+		{
+			const FName BoneName = RefSkeleton.GetBoneName(BoneIndex);
+			const FHitZone* HitZone = HitZones.FindByPredicate([BoneName](const FHitZone& TempHitZone)
+			{
+				return TempHitZone.BoneName == BoneName;
+			});
+
+			if (HitZone)
+			{
+				Table->BodyZones[BodyIndex] = *HitZone;
+				break;
+			}
+
+			BoneIndex = RefSkeleton.GetParentIndex(BoneIndex);
+		}
+	}
+
+	AssetTables.Add(Table);
+
+	return Table;
+}
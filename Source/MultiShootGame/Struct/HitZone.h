@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "HitZone.generated.h"
+
+class UPhysicsAsset;
+
+/**
+ * Damage multiplier for a bone and everything below it in the skeleton.
+ */
+USTRUCT(BlueprintType)
+struct MULTISHOOTGAME_API FHitZone
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = HitZone)
+	FName BoneName;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = HitZone)
+	float DamageMultiplier = 1.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = HitZone)
+	bool bHeadShot = false;
+
+	FORCEINLINE bool operator==(const FHitZone& Other) const
+	{
+		return BoneName == Other.BoneName && DamageMultiplier == Other.DamageMultiplier &&
+			bHeadShot == Other.bHeadShot;
+	}
+};
+
+/**
+ * Hit zones resolved per physics body index, built once per physics asset and hit zone setup and shared by every
+ * mesh using that pair.
+ */
+struct MULTISHOOTGAME_API FHitZoneTable
+{
+	TArray<FHitZone> BodyZones;
+
+	/** Hit zones the table was built from, two components only share a table when these match. */
+	TArray<FHitZone> SourceZones;
+
+	FORCEINLINE const FHitZone* Find(int32 BodyIndex) const
+	{
+		return BodyZones.IsValidIndex(BodyIndex) ? &BodyZones[BodyIndex] : nullptr;
+	}
+
+	static TSharedPtr<const FHitZoneTable> FindOrBuild(const USkeletalMeshComponent* MeshComponent,
+	                                                   const TArray<FHitZone>& HitZones);
+
+private:
+	static TMap<TObjectKey<UPhysicsAsset>, TArray<TSharedPtr<const FHitZoneTable>>> Tables;
+};
@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/NetSerialization.h"
+#include "ImpactEvent.generated.h"
+
+/**
+ * One cosmetic bullet impact, quantized for the per-frame batch the server sends to each client.
+ */
+USTRUCT(BlueprintType)
+struct MULTISHOOTGAME_API FImpactEvent
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = ImpactEvent)
+	FVector_NetQuantize Location;
+
+	UPROPERTY(BlueprintReadWrite, Category = ImpactEvent)
+	FVector_NetQuantizeNormal Normal;
+
+	UPROPERTY(BlueprintReadWrite, Category = ImpactEvent)
+	FVector_NetQuantizeNormal Direction;
+
+	UPROPERTY(BlueprintReadWrite, Category = ImpactEvent)
+	TEnumAsByte<EPhysicalSurface> SurfaceType = SurfaceType_Default;
+
+	/** Class implementing IMultiShootGameImpactSource that describes the effect and decal. */
+	UPROPERTY(BlueprintReadWrite, Category = ImpactEvent)
+	UClass* SourceClass = nullptr;
+
+	UPROPERTY(BlueprintReadWrite, Category = ImpactEvent)
+	bool bSpawnDecal = false;
+};
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiShootGame/Enum/EMinimapIconType.h"
+#include "MinimapIcon.generated.h"
+
+/**
+ * One actor to draw on the minimap. Position is in map space, -1 to 1 from the map center, with X to the right and
+ * Y down like widget space.
+ */
+USTRUCT(BlueprintType)
+struct MULTISHOOTGAME_API FMinimapIcon
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = MinimapIcon)
+	AActor* Actor = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = MinimapIcon)
+	EMinimapIconType IconType = EMinimapIconType::Self;
+
+	UPROPERTY(BlueprintReadOnly, Category = MinimapIcon)
+	FVector2D Position = FVector2D::ZeroVector;
+
+	/** Icon rotation relative to the map, in degrees. */
+	UPROPERTY(BlueprintReadOnly, Category = MinimapIcon)
+	float Yaw = 0.f;
+};
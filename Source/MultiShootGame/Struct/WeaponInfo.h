@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "../Weapon/MultiShootGameProjectileBase.h"
 #include "Engine/DataTable.h"
+#include "Sound/SoundConcurrency.h"
 #include "Sound/SoundCue.h"
 #include "WeaponInfo.generated.h"
 
@@ -31,9 +32,25 @@ struct MULTISHOOTGAME_API FWeaponInfo : public FTableRowBase
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = WeaponInfo)
 	USoundCue* FireSoundCue;
 
+	/** Optional looping sound that replaces FireSoundCue while firing full-auto. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = WeaponInfo)
+	USoundCue* FireLoopSoundCue;
+
+	/** Played when the fire loop stops. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = WeaponInfo)
+	USoundCue* FireTailSoundCue;
+
+	/** Concurrency group shared by every weapon of this kind, limiting how many fire voices play at once. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = WeaponInfo)
+	USoundConcurrency* FireSoundConcurrency;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Character)
 	UParticleSystem* MuzzleEffect;
 
+	/** Optional looping flash played instead of MuzzleEffect while firing full-auto. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Character)
+	UParticleSystem* MuzzleBurstEffect;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = WeaponInfo)
 	TSubclassOf<AMultiShootGameProjectileBase> ProjectileClass;
 
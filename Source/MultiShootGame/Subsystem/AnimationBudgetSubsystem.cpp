@@ -0,0 +1,233 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "AnimationBudgetSubsystem.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
+
+DECLARE_CYCLE_STAT(TEXT("Animation Budget Tick"), STAT_AnimationBudgetTick, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Animation Poses Skipped"), STAT_AnimationPosesSkipped, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Animation Bone Refreshes"), STAT_AnimationBoneRefreshes, STATGROUP_MultiShootGame);
+
+bool UAnimationBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAnimationBudgetSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AnimationBudgetTick);
+
+	const UWorld* World = GetWorld();
+
+	// Projectiles move every frame, so the bones ahead of them can't wait for the next budget update
+	if (World->GetNetMode() != NM_Client && Projectiles.Num() > 0)
+	{
+		RefreshBonesAlongProjectiles();
+	}
+
+	CurrentUpdateTime += DeltaTime;
+	if (CurrentUpdateTime < UpdateInterval)
+	{
+		return;
+	}
+	CurrentUpdateTime = 0.f;
+
+	Enemies.RemoveAll([](const AMultiShootGameEnemyCharacter* Enemy)
+	{
+		return !IsValid(Enemy);
+	});
+
+	if (World->GetNetMode() != NM_Client)
+	{
+		TArray<FVector> ViewLocations;
+		TArray<FVector> ViewDirections;
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			const APlayerController* PlayerController = Iterator->Get();
+			if (PlayerController && PlayerController->GetPawn())
+			{
+				FVector ViewLocation;
+				FRotator ViewRotation;
+				PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+				ViewLocations.Add(ViewLocation);
+				ViewDirections.Add(ViewRotation.Vector());
+			}
+		}
+
+		UpdateServer(ViewLocations, ViewDirections);
+	}
+
+	const APlayerCameraManager* PlayerCameraManager = UGameplayStatics::GetPlayerCameraManager(World, 0);
+	if (World->GetNetMode() != NM_DedicatedServer && PlayerCameraManager)
+	{
+		UpdateClient(PlayerCameraManager->GetCameraLocation());
+	}
+}
+
+TStatId UAnimationBudgetSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_AnimationBudgetTick);
+}
+
+void UAnimationBudgetSubsystem::UpdateServer(const TArray<FVector>& ViewLocations,
+                                             const TArray<FVector>& ViewDirections)
+{
+	NumSkippedPoses = 0;
+
+	const float ViewAngleCos = FMath::Cos(FMath::DegreesToRadians(ShootableViewAngle));
+
+	for (AMultiShootGameEnemyCharacter* Enemy : Enemies)
+	{
+		// Anything a player is looking at may be shot, whether or not the bot is facing that player. A listen
+		// server's own view also counts through rendering.
+		bool bShootable = Enemy->GetMesh()->WasRecentlyRendered(UpdateInterval);
+		for (int i = 0; i < ViewLocations.Num() && !bShootable; i++)
+		{
+			const FVector ToEnemy = Enemy->GetActorLocation() - ViewLocations[i];
+			const float DistanceSquared = ToEnemy.SizeSquared();
+
+			bShootable = DistanceSquared <= FMath::Square(ServerAlwaysTickDistance) ||
+				(DistanceSquared <= FMath::Square(ShootableViewDistance) &&
+					FVector::DotProduct(ToEnemy.GetSafeNormal(), ViewDirections[i]) >= ViewAngleCos);
+		}
+
+		if (bShootable)
+		{
+			Enemy->GetMesh()->VisibilityBasedAnimTickOption =
+				EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+		}
+		else
+		{
+			Enemy->GetMesh()->VisibilityBasedAnimTickOption =
+				EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+			NumSkippedPoses++;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AnimationPosesSkipped, NumSkippedPoses);
+}
+
+void UAnimationBudgetSubsystem::UpdateClient(const FVector& ViewLocation)
+{
+	TArray<TPair<float, AMultiShootGameEnemyCharacter*>> RankedEnemies;
+	RankedEnemies.Reserve(Enemies.Num());
+	for (AMultiShootGameEnemyCharacter* Enemy : Enemies)
+	{
+		RankedEnemies.Emplace(FVector::Dist(ViewLocation, Enemy->GetActorLocation()), Enemy);
+	}
+
+	RankedEnemies.Sort([](const TPair<float, AMultiShootGameEnemyCharacter*>& A,
+	                      const TPair<float, AMultiShootGameEnemyCharacter*>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (int i = 0; i < RankedEnemies.Num(); i++)
+	{
+		const float Distance = RankedEnemies[i].Key;
+		USkeletalMeshComponent* Mesh = RankedEnemies[i].Value->GetMesh();
+
+		float TickInterval = 0.f;
+		if (!Mesh->WasRecentlyRendered())
+		{
+			TickInterval = MaxTickInterval;
+		}
+		else if (i >= MaxFullRateMeshes || Distance > FullRateDistance)
+		{
+			const int Band = 1 + FMath::Max(FMath::FloorToInt((Distance - FullRateDistance) / BandDistance), 0);
+			TickInterval = FMath::Min(Band * BandTickInterval, MaxTickInterval);
+		}
+
+		Mesh->SetComponentTickInterval(TickInterval);
+	}
+}
+
+void UAnimationBudgetSubsystem::RegisterEnemy(AMultiShootGameEnemyCharacter* Enemy)
+{
+	Enemies.AddUnique(Enemy);
+}
+
+void UAnimationBudgetSubsystem::UnregisterEnemy(AMultiShootGameEnemyCharacter* Enemy)
+{
+	Enemies.Remove(Enemy);
+}
+
+void UAnimationBudgetSubsystem::RegisterProjectile(AActor* Projectile)
+{
+	Projectiles.AddUnique(Projectile);
+}
+
+void UAnimationBudgetSubsystem::UnregisterProjectile(AActor* Projectile)
+{
+	Projectiles.Remove(Projectile);
+}
+
+bool UAnimationBudgetSubsystem::IsPoseSkipped(const AMultiShootGameEnemyCharacter* Enemy)
+{
+	return IsValid(Enemy) && Enemy->GetMesh()->VisibilityBasedAnimTickOption !=
+		EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+}
+
+void UAnimationBudgetSubsystem::RefreshBones(AMultiShootGameEnemyCharacter* Enemy)
+{
+	// Without a tick function the evaluation runs synchronously, so the bones are ready for the query
+	USkeletalMeshComponent* Mesh = Enemy->GetMesh();
+	Mesh->TickAnimation(0.f, false);
+	Mesh->RefreshBoneTransforms();
+	INC_DWORD_STAT(STAT_AnimationBoneRefreshes);
+}
+
+void UAnimationBudgetSubsystem::RefreshBonesAlongProjectiles()
+{
+	Projectiles.RemoveAll([](const TWeakObjectPtr<AActor>& Projectile)
+	{
+		return !Projectile.IsValid();
+	});
+
+	// One segment per movement component, so every shotgun pellet is covered
+	TArray<TPair<FVector, FVector>> Segments;
+	for (const TWeakObjectPtr<AActor>& Projectile : Projectiles)
+	{
+		TInlineComponentArray<UProjectileMovementComponent*> MovementComponents(Projectile.Get());
+		for (const UProjectileMovementComponent* MovementComponent : MovementComponents)
+		{
+			if (IsValid(MovementComponent->UpdatedComponent) && !MovementComponent->Velocity.IsNearlyZero())
+			{
+				const FVector Start = MovementComponent->UpdatedComponent->GetComponentLocation();
+				Segments.Emplace(Start, Start + MovementComponent->Velocity * ProjectileLookAheadTime);
+			}
+		}
+	}
+
+	for (AMultiShootGameEnemyCharacter* Enemy : Enemies)
+	{
+		if (!IsPoseSkipped(Enemy))
+		{
+			continue;
+		}
+
+		for (const TPair<FVector, FVector>& Segment : Segments)
+		{
+			if (FMath::PointDistToSegmentSquared(Enemy->GetActorLocation(), Segment.Key, Segment.Value) <=
+				FMath::Square(ProjectileRefreshRadius))
+			{
+				RefreshBones(Enemy);
+				break;
+			}
+		}
+	}
+}
+
+void UAnimationBudgetSubsystem::RefreshBonesForHitValidation(const FVector& Location, float Radius) const
+{
+	for (AMultiShootGameEnemyCharacter* Enemy : Enemies)
+	{
+		if (IsPoseSkipped(Enemy) && FVector::DistSquared(Location, Enemy->GetActorLocation()) <= FMath::Square(Radius))
+		{
+			RefreshBones(Enemy);
+		}
+	}
+}
@@ -0,0 +1,94 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiShootGameTickableWorldSubsystem.h"
+#include "AnimationBudgetSubsystem.generated.h"
+
+class AMultiShootGameEnemyCharacter;
+
+/**
+ * Enemy animation budget. On the server, pose evaluation is skipped for bots outside every player's view, and
+ * bones are refreshed on demand ahead of in-flight projectiles and before melee traces. On clients, bots are ranked
+ * by distance to the local view and their mesh tick interval grows with rank and distance on top of update rate
+ * optimizations.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UAnimationBudgetSubsystem : public UMultiShootGameTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	float UpdateInterval = 0.25f;
+
+	UPROPERTY(Config)
+	float ServerAlwaysTickDistance = 1500.f;
+
+	/** Half-angle of the cone in front of each player's view in which bots keep their full pose. */
+	UPROPERTY(Config)
+	float ShootableViewAngle = 75.f;
+
+	UPROPERTY(Config)
+	float ShootableViewDistance = 15000.f;
+
+	UPROPERTY(Config)
+	float ProjectileLookAheadTime = 0.1f;
+
+	UPROPERTY(Config)
+	float ProjectileRefreshRadius = 200.f;
+
+	UPROPERTY(Config)
+	int MaxFullRateMeshes = 8;
+
+	UPROPERTY(Config)
+	float FullRateDistance = 2000.f;
+
+	UPROPERTY(Config)
+	float BandDistance = 1500.f;
+
+	UPROPERTY(Config)
+	float BandTickInterval = 1.f / 30.f;
+
+	UPROPERTY(Config)
+	float MaxTickInterval = 0.2f;
+
+	UPROPERTY()
+	TArray<AMultiShootGameEnemyCharacter*> Enemies;
+
+	TArray<TWeakObjectPtr<AActor>> Projectiles;
+
+	float CurrentUpdateTime = 0.f;
+
+	int NumSkippedPoses = 0;
+
+	void UpdateServer(const TArray<FVector>& ViewLocations, const TArray<FVector>& ViewDirections);
+
+	void RefreshBonesAlongProjectiles();
+
+	static bool IsPoseSkipped(const AMultiShootGameEnemyCharacter* Enemy);
+
+	static void RefreshBones(AMultiShootGameEnemyCharacter* Enemy);
+
+	void UpdateClient(const FVector& ViewLocation);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	void RegisterEnemy(AMultiShootGameEnemyCharacter* Enemy);
+
+	void UnregisterEnemy(AMultiShootGameEnemyCharacter* Enemy);
+
+	/** Server projectiles register so bots ahead of them have current bones by the time the overlap happens. */
+	void RegisterProjectile(AActor* Projectile);
+
+	void UnregisterProjectile(AActor* Projectile);
+
+	/** Brings skipped poses around Location up to date so a hit-validation query sees the current bones. */
+	void RefreshBonesForHitValidation(const FVector& Location, float Radius) const;
+};
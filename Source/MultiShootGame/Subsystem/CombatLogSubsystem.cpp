@@ -0,0 +1,236 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatLogSubsystem.h"
+#include "Async/Async.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/Paths.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include <type_traits>
+
+DECLARE_CYCLE_STAT(TEXT("Combat Log Tick"), STAT_CombatLogTick, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat Log Records"), STAT_CombatLogRecords, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Combat Log Dropped"), STAT_CombatLogDropped, STATGROUP_MultiShootGame);
+
+static_assert(std::is_trivially_copyable<FCombatLogRecord>::value, "Combat log records are written as raw bytes");
+static_assert(sizeof(FCombatLogRecord) == 48, "Combat log record layout changed, bump CombatLogVersion");
+
+static constexpr uint32 CombatLogMagic = 0x4C43534D; // "MSCL"
+static constexpr uint32 CombatLogVersion = 1;
+
+static int32 GetCombatLogPlayerId(const AActor* Actor)
+{
+	const APawn* Pawn = Cast<APawn>(Actor);
+	const APlayerState* PlayerState = Pawn ? Pawn->GetPlayerState() : nullptr;
+
+	return PlayerState ? PlayerState->GetPlayerId() : INDEX_NONE;
+}
+
+static void SetCombatLogLocation(FCombatLogRecord& Record, const FVector& Location)
+{
+	Record.LocationX = Location.X;
+	Record.LocationY = Location.Y;
+	Record.LocationZ = Location.Z;
+}
+
+bool UCombatLogSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatLogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (!bEnableCombatLog)
+	{
+		return;
+	}
+
+	Records = MakeUnique<TCircularQueue<FCombatLogRecord>>(FMath::Max(MaxRecords, 2));
+
+	LogFilePath = FPaths::Combine(FPaths::ProjectSavedDir(), LogDirectory,
+	                              FString::Printf(TEXT("CombatLog_%s_%s.bin"), *FDateTime::Now().ToString(),
+	                                              *GetWorld()->GetName()));
+}
+
+void UCombatLogSubsystem::Deinitialize()
+{
+	if (FlushTask.IsValid())
+	{
+		FlushTask.Wait();
+	}
+
+	// The flush task is done, so the game thread is the only reader left
+	if (Records.IsValid())
+	{
+		FlushRecords();
+		ReportDropped();
+	}
+
+	Super::Deinitialize();
+}
+
+void UCombatLogSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_CombatLogTick);
+
+	if (!Records.IsValid())
+	{
+		return;
+	}
+
+	ReportDropped();
+
+	CurrentFlushTime += DeltaTime;
+	if (CurrentFlushTime >= FlushInterval)
+	{
+		CurrentFlushTime = 0.f;
+
+		StartFlush();
+	}
+}
+
+TStatId UCombatLogSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_CombatLogTick);
+}
+
+void UCombatLogSubsystem::AddRecord(ECombatEventType EventType, const AActor* Source, const AActor* Target,
+                                    float Value)
+{
+	if (!Records.IsValid() || GetWorld()->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	FCombatLogRecord NewRecord;
+	NewRecord.Time = GetWorld()->GetTimeSeconds();
+	NewRecord.EventType = EventType;
+	NewRecord.Value = Value;
+
+	if (Source)
+	{
+		NewRecord.SourceId = Source->GetUniqueID();
+		NewRecord.SourcePlayerId = GetCombatLogPlayerId(Source);
+		SetCombatLogLocation(NewRecord, Source->GetActorLocation());
+	}
+
+	if (Target)
+	{
+		NewRecord.TargetId = Target->GetUniqueID();
+		NewRecord.TargetPlayerId = GetCombatLogPlayerId(Target);
+		SetCombatLogLocation(NewRecord, Target->GetActorLocation());
+	}
+
+	if (!Records->Enqueue(NewRecord))
+	{
+		PendingDropped.fetch_add(1, std::memory_order_relaxed);
+		TotalDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_CombatLogRecords);
+}
+
+void UCombatLogSubsystem::Record(const UObject* WorldContextObject, ECombatEventType EventType,
+                                 const AActor* Source, const AActor* Target, float Value)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UCombatLogSubsystem* CombatLogSubsystem = World ? World->GetSubsystem<UCombatLogSubsystem>() : nullptr;
+
+	if (CombatLogSubsystem)
+	{
+		CombatLogSubsystem->AddRecord(EventType, Source, Target, Value);
+	}
+}
+
+void UCombatLogSubsystem::StartFlush()
+{
+	if (FlushTask.IsValid() && !FlushTask.IsReady())
+	{
+		return;
+	}
+
+	if (Records->IsEmpty() && PendingDropped.load(std::memory_order_relaxed) == 0)
+	{
+		return;
+	}
+
+	// Deinitialize waits for the task, so it never outlives the subsystem
+	FlushTask = Async(EAsyncExecution::ThreadPool, [this]()
+	{
+		FlushRecords();
+	});
+}
+
+void UCombatLogSubsystem::FlushRecords()
+{
+	FlushBuffer.Reset();
+
+	FCombatLogRecord DequeuedRecord;
+	while (Records->Dequeue(DequeuedRecord))
+	{
+		FlushBuffer.Add(DequeuedRecord);
+	}
+
+	const uint32 Dropped = PendingDropped.exchange(0, std::memory_order_relaxed);
+	if (FlushBuffer.Num() == 0 && Dropped == 0)
+	{
+		return;
+	}
+
+	// A chunk with no records still reports the drops
+	const int32 UncompressedSize = FlushBuffer.Num() * sizeof(FCombatLogRecord);
+	int32 CompressedSize = UncompressedSize > 0 ? FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize) : 0;
+	CompressedBuffer.SetNumUninitialized(CompressedSize, false);
+
+	if (UncompressedSize > 0 && !FCompression::CompressMemory(NAME_Zlib, CompressedBuffer.GetData(), CompressedSize,
+	                                                          FlushBuffer.GetData(), UncompressedSize))
+	{
+		UE_LOG(LogMultiShootGame, Warning, TEXT("Combat log: failed to compress %d records"), FlushBuffer.Num());
+		return;
+	}
+
+	const TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*LogFilePath, FILEWRITE_Append));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogMultiShootGame, Warning, TEXT("Combat log: can't open %s"), *LogFilePath);
+		return;
+	}
+
+	if (!bWroteFileHeader)
+	{
+		uint32 Magic = CombatLogMagic;
+		uint32 Version = CombatLogVersion;
+		uint32 RecordSize = sizeof(FCombatLogRecord);
+		*Writer << Magic << Version << RecordSize;
+
+		bWroteFileHeader = true;
+	}
+
+	// Chunk: record count, records dropped since the last chunk, raw size, compressed size, zlib data
+	uint32 RecordCount = FlushBuffer.Num();
+	uint32 ChunkDropped = Dropped;
+	uint32 ChunkUncompressedSize = UncompressedSize;
+	uint32 ChunkCompressedSize = CompressedSize;
+	*Writer << RecordCount << ChunkDropped << ChunkUncompressedSize << ChunkCompressedSize;
+	Writer->Serialize(CompressedBuffer.GetData(), CompressedSize);
+}
+
+void UCombatLogSubsystem::ReportDropped()
+{
+	const uint32 CurrentDropped = TotalDropped.load(std::memory_order_relaxed);
+	if (CurrentDropped == ReportedDropped)
+	{
+		return;
+	}
+
+	UE_LOG(LogMultiShootGame, Warning, TEXT("Combat log: writer outpaced the flusher, %u records dropped (%u total)"),
+	       CurrentDropped - ReportedDropped, CurrentDropped);
+
+	ReportedDropped = CurrentDropped;
+	SET_DWORD_STAT(STAT_CombatLogDropped, CurrentDropped);
+}
@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "MultiShootGameTickableWorldSubsystem.h"
+#include "MultiShootGame/Enum/ECombatEventType.h"
+#include <atomic>
+#include "CombatLogSubsystem.generated.h"
+
+/**
+ * Fixed-size combat event record, copied as raw bytes into the log file.
+ */
+struct FCombatLogRecord
+{
+	double Time = 0.0;
+
+	uint32 SourceId = 0;
+
+	int32 SourcePlayerId = INDEX_NONE;
+
+	uint32 TargetId = 0;
+
+	int32 TargetPlayerId = INDEX_NONE;
+
+	float LocationX = 0.f;
+
+	float LocationY = 0.f;
+
+	float LocationZ = 0.f;
+
+	float Value = 0.f;
+
+	ECombatEventType EventType = ECombatEventType::Shot;
+
+	uint8 Padding[7] = {};
+};
+
+/**
+ * Server-side log of every shot, hit, kill and death for balancing and anti-cheat review. Gameplay code only
+ * pushes records into a lock-free ring buffer; a background task compresses and appends them to a binary file.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UCombatLogSubsystem : public UMultiShootGameTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	bool bEnableCombatLog = true;
+
+	UPROPERTY(Config)
+	int MaxRecords = 16384;
+
+	UPROPERTY(Config)
+	float FlushInterval = 2.f;
+
+	UPROPERTY(Config)
+	FString LogDirectory = TEXT("CombatLogs");
+
+	TUniquePtr<TCircularQueue<FCombatLogRecord>> Records;
+
+	TFuture<void> FlushTask;
+
+	FString LogFilePath;
+
+	bool bWroteFileHeader = false;
+
+	float CurrentFlushTime = 0.f;
+
+	std::atomic<uint32> PendingDropped{0};
+
+	std::atomic<uint32> TotalDropped{0};
+
+	uint32 ReportedDropped = 0;
+
+	TArray<FCombatLogRecord> FlushBuffer;
+
+	TArray<uint8> CompressedBuffer;
+
+	void StartFlush();
+
+	/** Drains the ring buffer and appends one compressed chunk. Runs on the flush task, or inline at shutdown. */
+	void FlushRecords();
+
+	void ReportDropped();
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	void AddRecord(ECombatEventType EventType, const AActor* Source, const AActor* Target, float Value);
+
+	static void Record(const UObject* WorldContextObject, ECombatEventType EventType, const AActor* Source,
+	                   const AActor* Target, float Value = 0.f);
+
+	FORCEINLINE uint32 GetTotalDropped() const { return TotalDropped.load(std::memory_order_relaxed); }
+};
@@ -0,0 +1,137 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "DamageQueueSubsystem.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/Component/HealthComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Damage Queue Flush"), STAT_DamageQueueFlush, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Queue Hits"), STAT_DamageQueueHits, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Queue Victims"), STAT_DamageQueueVictims, STATGROUP_MultiShootGame);
+
+bool UDamageQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDamageQueueSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+		this, &UDamageQueueSubsystem::OnWorldPostActorTick);
+}
+
+void UDamageQueueSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PendingDamages.Empty();
+
+	Super::Deinitialize();
+}
+
+UDamageQueueSubsystem::FPendingDamage& UDamageQueueSubsystem::FindOrAddPending(UHealthComponent* HealthComponent)
+{
+	FPendingDamage& PendingDamage = PendingDamages.FindOrAdd(HealthComponent);
+	PendingDamage.HealthComponent = HealthComponent;
+
+	return PendingDamage;
+}
+
+bool UDamageQueueSubsystem::QueueDamage(UHealthComponent* HealthComponent, float Damage,
+                                        const UDamageType* DamageType, AController* InstigatedBy,
+                                        AActor* DamageCauser)
+{
+	if (!bBatchDamage || HealthComponent == nullptr)
+	{
+		return false;
+	}
+
+	FQueuedHit& Hit = FindOrAddPending(HealthComponent).Hits.AddDefaulted_GetRef();
+	Hit.Damage = Damage;
+	Hit.DamageType = DamageType;
+	Hit.InstigatedBy = InstigatedBy;
+	Hit.DamageCauser = DamageCauser;
+
+	INC_DWORD_STAT(STAT_DamageQueueHits);
+
+	return true;
+}
+
+bool UDamageQueueSubsystem::QueueHeadShot(UHealthComponent* HealthComponent, AActor* DamageCauser)
+{
+	if (!bBatchDamage || HealthComponent == nullptr)
+	{
+		return false;
+	}
+
+	FindOrAddPending(HealthComponent).HeadShotCausers.Add(DamageCauser);
+
+	return true;
+}
+
+void UDamageQueueSubsystem::OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld == GetWorld())
+	{
+		Flush();
+	}
+}
+
+void UDamageQueueSubsystem::Flush()
+{
+	if (PendingDamages.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_DamageQueueFlush);
+
+	// Damage caused by the handlers below, e.g. a death explosion, is resolved next frame
+	TMap<TObjectKey<UHealthComponent>, FPendingDamage> ResolvingDamages = MoveTemp(PendingDamages);
+	PendingDamages.Reset();
+
+	for (TPair<TObjectKey<UHealthComponent>, FPendingDamage>& Pair : ResolvingDamages)
+	{
+		FPendingDamage& PendingDamage = Pair.Value;
+
+		UHealthComponent* HealthComponent = PendingDamage.HealthComponent.Get();
+		if (HealthComponent == nullptr || HealthComponent->bDied)
+		{
+			continue;
+		}
+
+		INC_DWORD_STAT(STAT_DamageQueueVictims);
+
+		// Headshots are scored before the damage lands, matching the unbatched order where a killing headshot
+		// still counts
+		for (const TWeakObjectPtr<AActor>& DamageCauser : PendingDamage.HeadShotCausers)
+		{
+			HealthComponent->OnHeadShot.Broadcast(DamageCauser.Get());
+		}
+
+		if (PendingDamage.Hits.Num() == 0)
+		{
+			continue;
+		}
+
+		// The hit that takes health to zero gets the kill credit, otherwise the last hit of the frame
+		float TotalDamage = 0.f;
+		const FQueuedHit* CreditedHit = nullptr;
+		for (const FQueuedHit& Hit : PendingDamage.Hits)
+		{
+			TotalDamage += Hit.Damage;
+			if (CreditedHit == nullptr && TotalDamage >= HealthComponent->GetHealth())
+			{
+				CreditedHit = &Hit;
+			}
+		}
+
+		if (CreditedHit == nullptr)
+		{
+			CreditedHit = &PendingDamage.Hits.Last();
+		}
+
+		HealthComponent->ApplyDamage(TotalDamage, CreditedHit->DamageType, CreditedHit->InstigatedBy.Get(),
+		                             CreditedHit->DamageCauser.Get());
+	}
+}
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "DamageQueueSubsystem.generated.h"
+
+class UHealthComponent;
+
+/**
+ * Collects damage per victim during the frame and resolves it once after all actors have ticked, so a shotgun
+ * blast or grenade costs one health change, one OnHealthChanged broadcast and one net update per victim.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UDamageQueueSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	bool bBatchDamage = true;
+
+	struct FQueuedHit
+	{
+		float Damage = 0.f;
+
+		const UDamageType* DamageType = nullptr;
+
+		TWeakObjectPtr<AController> InstigatedBy;
+
+		TWeakObjectPtr<AActor> DamageCauser;
+	};
+
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<UHealthComponent> HealthComponent;
+
+		TArray<FQueuedHit, TInlineAllocator<8>> Hits;
+
+		TArray<TWeakObjectPtr<AActor>, TInlineAllocator<2>> HeadShotCausers;
+	};
+
+	TMap<TObjectKey<UHealthComponent>, FPendingDamage> PendingDamages;
+
+	FDelegateHandle PostActorTickHandle;
+
+	FPendingDamage& FindOrAddPending(UHealthComponent* HealthComponent);
+
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	/** Returns false when batching is disabled and the caller should apply the damage itself. */
+	bool QueueDamage(UHealthComponent* HealthComponent, float Damage, const UDamageType* DamageType,
+	                 AController* InstigatedBy, AActor* DamageCauser);
+
+	/** Returns false when batching is disabled and the caller should broadcast the headshot itself. */
+	bool QueueHeadShot(UHealthComponent* HealthComponent, AActor* DamageCauser);
+
+	void Flush();
+};
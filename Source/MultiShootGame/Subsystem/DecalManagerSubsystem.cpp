@@ -0,0 +1,262 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "DecalManagerSubsystem.h"
+#include "Components/DecalComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "MultiShootGame/MultiShootGame.h"
+
+DECLARE_CYCLE_STAT(TEXT("Decal Manager Tick"), STAT_DecalManagerTick, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Decals Active"), STAT_DecalsActive, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Decals Merged"), STAT_DecalsMerged, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Decals Recycled"), STAT_DecalsRecycled, STATGROUP_MultiShootGame);
+
+bool UDecalManagerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDecalManagerSubsystem::Deinitialize()
+{
+	DecalComponents.Empty();
+	DecalSlots.Empty();
+	CellSlots.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDecalManagerSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DecalManagerTick);
+
+	CurrentUpdateTime += DeltaTime;
+	if (NumActive == 0 || CurrentUpdateTime < UpdateInterval)
+	{
+		return;
+	}
+	CurrentUpdateTime = 0.f;
+
+	const UWorld* World = GetWorld();
+	const double CurrentTime = World->GetTimeSeconds();
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController && PlayerController->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	const float CullDistanceSquared = FMath::Square(CullDistance);
+
+	for (int SlotIndex = 0; SlotIndex < DecalSlots.Num(); SlotIndex++)
+	{
+		const FDecalSlot& Slot = DecalSlots[SlotIndex];
+		if (!Slot.bActive)
+		{
+			continue;
+		}
+
+		if (Slot.bFading)
+		{
+			if (CurrentTime >= Slot.FadeEndTime)
+			{
+				ReleaseSlot(SlotIndex);
+			}
+			continue;
+		}
+
+		bool bFarFromViews = ViewLocations.Num() > 0;
+		const FVector DecalLocation = DecalComponents[SlotIndex]->GetComponentLocation();
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			if (FVector::DistSquared(ViewLocation, DecalLocation) <= CullDistanceSquared)
+			{
+				bFarFromViews = false;
+				break;
+			}
+		}
+
+		if (bFarFromViews || CurrentTime >= Slot.FadeStartTime)
+		{
+			StartFade(SlotIndex, CurrentTime);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_DecalsActive, NumActive);
+}
+
+TStatId UDecalManagerSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_DecalManagerTick);
+}
+
+FIntVector UDecalManagerSubsystem::GetCell(const FVector& Location) const
+{
+	const float CellSize = FMath::Max(MergeDistance, 1.f);
+
+	return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize),
+	                  FMath::FloorToInt(Location.Z / CellSize));
+}
+
+int UDecalManagerSubsystem::FindMergeSlot(const FIntVector& Cell, const UMaterialInterface* Material,
+                                          const USceneComponent* AttachComponent) const
+{
+	TArray<int, TInlineAllocator<4>> SlotIndices;
+	CellSlots.MultiFind(Cell, SlotIndices);
+
+	for (const int SlotIndex : SlotIndices)
+	{
+		const FDecalSlot& Slot = DecalSlots[SlotIndex];
+		// A decal whose moving parent is gone reads as unattached but still has a cell in the old parent's space
+		if (Slot.bActive && !Slot.bFading && Slot.Material.Get() == Material &&
+			Slot.AttachComponent.Get() == AttachComponent &&
+			(AttachComponent || Slot.AttachComponent.IsExplicitlyNull()))
+		{
+			return SlotIndex;
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+UDecalComponent* UDecalManagerSubsystem::GetOrCreateComponent(int SlotIndex)
+{
+	if (DecalComponents[SlotIndex] == nullptr)
+	{
+		UWorld* World = GetWorld();
+
+		UDecalComponent* DecalComponent = NewObject<UDecalComponent>(World->GetWorldSettings());
+		DecalComponent->bAutoActivate = true;
+		DecalComponent->FadeScreenSize = FadeScreenSize;
+		DecalComponent->RegisterComponentWithWorld(World);
+
+		DecalComponents[SlotIndex] = DecalComponent;
+	}
+
+	return DecalComponents[SlotIndex];
+}
+
+void UDecalManagerSubsystem::AddDecal(UMaterialInterface* Material, FVector Size, FVector Location,
+                                      FRotator Rotation, USceneComponent* AttachComponent)
+{
+	UWorld* World = GetWorld();
+	if (Material == nullptr || MaxDecals <= 0 || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	if (DecalSlots.Num() == 0)
+	{
+		DecalSlots.SetNum(MaxDecals);
+		DecalComponents.SetNumZeroed(MaxDecals);
+	}
+
+	// Decals on a moving component follow it, so they are bucketed in its space and only merge with each other
+	if (AttachComponent && AttachComponent->Mobility != EComponentMobility::Movable)
+	{
+		AttachComponent = nullptr;
+	}
+
+	const double CurrentTime = World->GetTimeSeconds();
+	const FIntVector Cell = GetCell(AttachComponent
+		                                ? AttachComponent->GetComponentTransform().InverseTransformPosition(Location)
+		                                : Location);
+
+	// Another hit on the same spot keeps the existing decal alive instead of stacking a new one
+	const int MergeSlot = FindMergeSlot(Cell, Material, AttachComponent);
+	if (MergeSlot != INDEX_NONE)
+	{
+		DecalSlots[MergeSlot].FadeStartTime = CurrentTime + FMath::Max(DecalLifeSpan - FadeDuration, 0.f);
+
+		INC_DWORD_STAT(STAT_DecalsMerged);
+		return;
+	}
+
+	// The ring always overwrites the oldest decal once it is full
+	const int SlotIndex = NextSlot;
+	NextSlot = (NextSlot + 1) % MaxDecals;
+
+	if (DecalSlots[SlotIndex].bActive)
+	{
+		ReleaseSlot(SlotIndex);
+
+		INC_DWORD_STAT(STAT_DecalsRecycled);
+	}
+
+	UDecalComponent* DecalComponent = GetOrCreateComponent(SlotIndex);
+	DecalComponent->SetDecalMaterial(Material);
+	DecalComponent->DecalSize = Size;
+	DecalComponent->SetFadeOut(0.f, 0.f, false);
+
+	if (AttachComponent)
+	{
+		DecalComponent->AttachToComponent(AttachComponent, FAttachmentTransformRules::KeepWorldTransform);
+	}
+	DecalComponent->SetWorldLocationAndRotation(Location, Rotation);
+	DecalComponent->SetVisibility(true);
+
+	FDecalSlot& Slot = DecalSlots[SlotIndex];
+	Slot.Cell = Cell;
+	Slot.Material = Material;
+	Slot.AttachComponent = AttachComponent;
+	Slot.FadeStartTime = CurrentTime + FMath::Max(DecalLifeSpan - FadeDuration, 0.f);
+	Slot.bActive = true;
+	Slot.bFading = false;
+
+	CellSlots.Add(Cell, SlotIndex);
+	NumActive++;
+}
+
+void UDecalManagerSubsystem::SpawnDecal(const UObject* WorldContextObject, UMaterialInterface* Material,
+                                        FVector Size, FVector Location, FRotator Rotation,
+                                        USceneComponent* AttachComponent)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UDecalManagerSubsystem* DecalManagerSubsystem = World ? World->GetSubsystem<UDecalManagerSubsystem>() : nullptr;
+
+	if (DecalManagerSubsystem)
+	{
+		DecalManagerSubsystem->AddDecal(Material, Size, Location, Rotation, AttachComponent);
+	}
+}
+
+void UDecalManagerSubsystem::StartFade(int SlotIndex, double CurrentTime)
+{
+	FDecalSlot& Slot = DecalSlots[SlotIndex];
+	Slot.bFading = true;
+	Slot.FadeEndTime = CurrentTime + FadeDuration;
+
+	// SetFadeOut also schedules the component's destruction, the ring reuses it instead
+	DecalComponents[SlotIndex]->SetFadeOut(0.f, FadeDuration, false);
+	DecalComponents[SlotIndex]->SetLifeSpan(0.f);
+}
+
+void UDecalManagerSubsystem::ReleaseSlot(int SlotIndex)
+{
+	FDecalSlot& Slot = DecalSlots[SlotIndex];
+	if (!Slot.bActive)
+	{
+		return;
+	}
+
+	CellSlots.RemoveSingle(Slot.Cell, SlotIndex);
+	Slot.AttachComponent.Reset();
+	Slot.bActive = false;
+	Slot.bFading = false;
+	NumActive--;
+
+	UDecalComponent* DecalComponent = DecalComponents[SlotIndex];
+	if (DecalComponent)
+	{
+		DecalComponent->SetVisibility(false);
+		if (DecalComponent->GetAttachParent())
+		{
+			DecalComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		}
+	}
+}
@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiShootGameTickableWorldSubsystem.h"
+#include "DecalManagerSubsystem.generated.h"
+
+class UDecalComponent;
+
+/**
+ * Global bullet decal budget. Decals live in a fixed-capacity ring of reused components, a new decal close to an
+ * existing one with the same material on the same surface refreshes it instead, and decals far from every local
+ * view fade early.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UDecalManagerSubsystem : public UMultiShootGameTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	int MaxDecals = 256;
+
+	UPROPERTY(Config)
+	float DecalLifeSpan = 10.f;
+
+	UPROPERTY(Config)
+	float FadeDuration = 1.f;
+
+	UPROPERTY(Config)
+	float MergeDistance = 8.f;
+
+	UPROPERTY(Config)
+	float FadeScreenSize = 0.002f;
+
+	UPROPERTY(Config)
+	float CullDistance = 4000.f;
+
+	UPROPERTY(Config)
+	float UpdateInterval = 0.25f;
+
+	struct FDecalSlot
+	{
+		FIntVector Cell = FIntVector::ZeroValue;
+
+		TWeakObjectPtr<UMaterialInterface> Material;
+
+		/** Movable component the decal is attached to, its cell is in that component's space. */
+		TWeakObjectPtr<USceneComponent> AttachComponent;
+
+		double FadeStartTime = 0.0;
+
+		double FadeEndTime = 0.0;
+
+		bool bActive = false;
+
+		bool bFading = false;
+	};
+
+	UPROPERTY()
+	TArray<UDecalComponent*> DecalComponents;
+
+	TArray<FDecalSlot> DecalSlots;
+
+	TMultiMap<FIntVector, int> CellSlots;
+
+	int NextSlot = 0;
+
+	int NumActive = 0;
+
+	float CurrentUpdateTime = 0.f;
+
+	FIntVector GetCell(const FVector& Location) const;
+
+	int FindMergeSlot(const FIntVector& Cell, const UMaterialInterface* Material,
+	                  const USceneComponent* AttachComponent) const;
+
+	UDecalComponent* GetOrCreateComponent(int SlotIndex);
+
+	void StartFade(int SlotIndex, double CurrentTime);
+
+	void ReleaseSlot(int SlotIndex);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	void AddDecal(UMaterialInterface* Material, FVector Size, FVector Location, FRotator Rotation,
+	              USceneComponent* AttachComponent = nullptr);
+
+	static void SpawnDecal(const UObject* WorldContextObject, UMaterialInterface* Material, FVector Size,
+	                       FVector Location, FRotator Rotation, USceneComponent* AttachComponent = nullptr);
+
+	FORCEINLINE int GetNumActive() const { return NumActive; }
+};
@@ -0,0 +1,269 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "EnemyPerceptionSubsystem.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/Character/MultiShootGameCharacter.h"
+#include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
+
+DECLARE_CYCLE_STAT(TEXT("Perception Tick"), STAT_PerceptionTick, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Queries"), STAT_PerceptionQueries, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Perception Queries Per Second"), STAT_PerceptionQueriesPerSecond,
+                               STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Budget Overrun"), STAT_PerceptionBudgetOverrun, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Perception Budget Overrun Per Second"), STAT_PerceptionBudgetOverrunPerSecond,
+                               STATGROUP_MultiShootGame);
+
+bool UEnemyPerceptionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyPerceptionSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PerceptionTick);
+
+	UWorld* World = GetWorld();
+	if (World == nullptr || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	Bots.RemoveAll([](const TWeakObjectPtr<AMultiShootGameEnemyCharacter>& Bot)
+	{
+		return !Bot.IsValid();
+	});
+
+	RefreshPlayerTargets();
+
+	const double CurrentTime = World->GetTimeSeconds();
+	const float PeripheralVisionCosine = FMath::Cos(FMath::DegreesToRadians(PeripheralVisionAngle));
+
+	// One entry per bot and player pair, no matter how many systems ask about it
+	TArray<FSightKey> DueKeys;
+	for (const TWeakObjectPtr<AMultiShootGameEnemyCharacter>& Bot : Bots)
+	{
+		const FVector BotLocation = Bot->GetActorLocation();
+
+		for (APawn* Target : PlayerTargets)
+		{
+			// Players of other hosted matches share the level but are never seen
+			if (!AMultiShootGamePlayerState::IsSameMatch(Bot.Get(), Target))
+			{
+				continue;
+			}
+
+			if (UHealthComponent::GetTeamAttitude(Bot.Get(), Target) != ETeamAttitude::Hostile)
+			{
+				continue;
+			}
+
+			const FSightKey SightKey(Bot.Get(), Target);
+			const float DistanceSquared = FVector::DistSquared(BotLocation, Target->GetActorLocation());
+
+			FSightEntry* Entry = SightEntries.Find(SightKey);
+			if (Entry == nullptr)
+			{
+				if (DistanceSquared > FMath::Square(SightRadius))
+				{
+					continue;
+				}
+
+				Entry = &SightEntries.Add(SightKey);
+				Entry->Bot = Bot;
+				Entry->Target = Target;
+			}
+
+			if (DistanceSquared > FMath::Square(Entry->bVisible ? LoseSightRadius : SightRadius))
+			{
+				SetVisible(*Entry, false);
+				continue;
+			}
+
+			const FVector Direction = (Target->GetActorLocation() - BotLocation).GetSafeNormal();
+			if (FVector::DotProduct(Bot->GetActorForwardVector(), Direction) < PeripheralVisionCosine)
+			{
+				SetVisible(*Entry, false);
+				continue;
+			}
+
+			if (!Entry->bPending && CurrentTime - Entry->LastQueryTime >= QueryInterval)
+			{
+				DueKeys.Add(SightKey);
+			}
+		}
+	}
+
+	// Entries are only looked up once the map has stopped growing
+	TArray<FSightEntry*> DueEntries;
+	for (const FSightKey& SightKey : DueKeys)
+	{
+		DueEntries.Add(SightEntries.Find(SightKey));
+	}
+
+	DueEntries.Sort([](const FSightEntry& A, const FSightEntry& B)
+	{
+		return A.LastQueryTime < B.LastQueryTime;
+	});
+
+	const int NumQueries = FMath::Min(DueEntries.Num(), MaxQueriesPerFrame);
+	for (int i = 0; i < NumQueries; i++)
+	{
+		FSightEntry* Entry = DueEntries[i];
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(EnemySight), false, Entry->Bot.Get());
+		QueryParams.AddIgnoredActor(Entry->Target.Get());
+
+		FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(
+			this, &UEnemyPerceptionSubsystem::OnSightTraceCompleted, FSightKey(Entry->Bot.Get(), Entry->Target.Get()));
+
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Entry->Bot->GetPawnViewLocation(),
+		                               Entry->Target->GetPawnViewLocation(), ECC_Visibility, QueryParams,
+		                               FCollisionResponseParams::DefaultResponseParam, &TraceDelegate);
+
+		Entry->bPending = true;
+		Entry->LastQueryTime = CurrentTime;
+	}
+
+	const int NumOverrun = DueEntries.Num() - NumQueries;
+
+	INC_DWORD_STAT_BY(STAT_PerceptionQueries, NumQueries);
+	INC_DWORD_STAT_BY(STAT_PerceptionBudgetOverrun, NumOverrun);
+
+	QueryCount += NumQueries;
+	OverrunCount += NumOverrun;
+	CurrentStatTime += DeltaTime;
+	if (CurrentStatTime >= 1.f)
+	{
+		QueriesPerSecond = FMath::RoundToInt(QueryCount / CurrentStatTime);
+		OverrunsPerSecond = FMath::RoundToInt(OverrunCount / CurrentStatTime);
+		QueryCount = 0;
+		OverrunCount = 0;
+		CurrentStatTime = 0.f;
+
+		SET_DWORD_STAT(STAT_PerceptionQueriesPerSecond, QueriesPerSecond);
+		SET_DWORD_STAT(STAT_PerceptionBudgetOverrunPerSecond, OverrunsPerSecond);
+	}
+}
+
+TStatId UEnemyPerceptionSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_PerceptionTick);
+}
+
+void UEnemyPerceptionSubsystem::RefreshPlayerTargets()
+{
+	PlayerTargets.Reset();
+
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		AMultiShootGameCharacter* Character = PlayerController
+			                                      ? Cast<AMultiShootGameCharacter>(PlayerController->GetPawn())
+			                                      : nullptr;
+		if (Character && !Character->GetHealthComponent()->bDied)
+		{
+			PlayerTargets.Add(Character);
+		}
+	}
+
+	// Drop pairs whose bot or player is gone, telling surviving bots they lost sight
+	for (auto It = SightEntries.CreateIterator(); It; ++It)
+	{
+		FSightEntry& Entry = It.Value();
+		if (!Entry.Bot.IsValid() || !Entry.Target.IsValid() || !PlayerTargets.Contains(Entry.Target.Get()))
+		{
+			SetVisible(Entry, false);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UEnemyPerceptionSubsystem::SetVisible(FSightEntry& Entry, bool bVisible) const
+{
+	if (Entry.bVisible == bVisible)
+	{
+		return;
+	}
+
+	Entry.bVisible = bVisible;
+
+	if (Entry.Bot.IsValid())
+	{
+		Entry.Bot->OnTargetSightChanged(Entry.Target.Get(), bVisible);
+	}
+}
+
+void UEnemyPerceptionSubsystem::OnSightTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum,
+                                                      FSightKey SightKey)
+{
+	FSightEntry* Entry = SightEntries.Find(SightKey);
+	if (Entry == nullptr)
+	{
+		return;
+	}
+
+	Entry->bPending = false;
+
+	const bool bBlocked = TraceDatum.OutHits.ContainsByPredicate([](const FHitResult& Hit)
+	{
+		return Hit.bBlockingHit;
+	});
+
+	SetVisible(*Entry, !bBlocked);
+}
+
+void UEnemyPerceptionSubsystem::RegisterBot(AMultiShootGameEnemyCharacter* Bot)
+{
+	Bots.AddUnique(Bot);
+}
+
+void UEnemyPerceptionSubsystem::UnregisterBot(AMultiShootGameEnemyCharacter* Bot)
+{
+	Bots.Remove(Bot);
+
+	for (auto It = SightEntries.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Key == TObjectKey<AMultiShootGameEnemyCharacter>(Bot))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool UEnemyPerceptionSubsystem::CanSee(const AMultiShootGameEnemyCharacter* Bot, const APawn* Target) const
+{
+	if (Bot == nullptr || Target == nullptr || !AMultiShootGamePlayerState::IsSameMatch(Bot, Target))
+	{
+		return false;
+	}
+
+	if (Bot->IsUsingSharedPerception())
+	{
+		const FSightEntry* Entry = SightEntries.Find(FSightKey(Bot, Target));
+
+		return Entry && Entry->bVisible;
+	}
+
+	const FVector BotLocation = Bot->GetActorLocation();
+	const FVector TargetLocation = Target->GetActorLocation();
+	if (FVector::DistSquared(BotLocation, TargetLocation) > FMath::Square(SightRadius))
+	{
+		return false;
+	}
+
+	const FVector Direction = (TargetLocation - BotLocation).GetSafeNormal();
+	if (FVector::DotProduct(Bot->GetActorForwardVector(), Direction) <
+		FMath::Cos(FMath::DegreesToRadians(PeripheralVisionAngle)))
+	{
+		return false;
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(EnemySight), false, Bot);
+	QueryParams.AddIgnoredActor(Target);
+
+	INC_DWORD_STAT(STAT_PerceptionQueries);
+
+	return !GetWorld()->LineTraceTestByChannel(Bot->GetPawnViewLocation(), Target->GetPawnViewLocation(),
+	                                           ECC_Visibility, QueryParams);
+}
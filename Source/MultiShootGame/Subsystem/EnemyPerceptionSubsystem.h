@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiShootGameTickableWorldSubsystem.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+#include "EnemyPerceptionSubsystem.generated.h"
+
+class AMultiShootGameEnemyCharacter;
+
+/**
+ * Shared sight service for enemies. Collects every bot-to-player sight query once per frame, issues them as
+ * budgeted async line traces and pushes visibility changes back to the bots.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UEnemyPerceptionSubsystem : public UMultiShootGameTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	float SightRadius = 5000.f;
+
+	UPROPERTY(Config)
+	float LoseSightRadius = 5500.f;
+
+	UPROPERTY(Config)
+	float PeripheralVisionAngle = 70.f;
+
+	UPROPERTY(Config)
+	float QueryInterval = 0.2f;
+
+	UPROPERTY(Config)
+	int MaxQueriesPerFrame = 32;
+
+	struct FSightEntry
+	{
+		TWeakObjectPtr<AMultiShootGameEnemyCharacter> Bot;
+
+		TWeakObjectPtr<APawn> Target;
+
+		double LastQueryTime = 0.0;
+
+		bool bPending = false;
+
+		bool bVisible = false;
+	};
+
+	typedef TPair<TObjectKey<AMultiShootGameEnemyCharacter>, TObjectKey<APawn>> FSightKey;
+
+	TMap<FSightKey, FSightEntry> SightEntries;
+
+	TArray<TWeakObjectPtr<AMultiShootGameEnemyCharacter>> Bots;
+
+	UPROPERTY()
+	TArray<APawn*> PlayerTargets;
+
+	int QueryCount = 0;
+
+	int OverrunCount = 0;
+
+	float CurrentStatTime = 0.f;
+
+	int QueriesPerSecond = 0;
+
+	int OverrunsPerSecond = 0;
+
+	void RefreshPlayerTargets();
+
+	void SetVisible(FSightEntry& Entry, bool bVisible) const;
+
+	void OnSightTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, FSightKey SightKey);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	void RegisterBot(AMultiShootGameEnemyCharacter* Bot);
+
+	void UnregisterBot(AMultiShootGameEnemyCharacter* Bot);
+
+	/**
+	 * Cached visibility for bots using shared perception. Other bots get a direct line of sight check with the same
+	 * radius and vision angle, so callers work with either kind of bot.
+	 */
+	bool CanSee(const AMultiShootGameEnemyCharacter* Bot, const APawn* Target) const;
+
+	/** Living player pawns, refreshed once per frame and shared by every bot. */
+	FORCEINLINE const TArray<APawn*>& GetPlayerTargets() const { return PlayerTargets; }
+
+	FORCEINLINE int GetQueriesPerSecond() const { return QueriesPerSecond; }
+
+	FORCEINLINE int GetOverrunsPerSecond() const { return OverrunsPerSecond; }
+};
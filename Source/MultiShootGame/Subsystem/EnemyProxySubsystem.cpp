@@ -0,0 +1,321 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "EnemyProxySubsystem.h"
+#include "AIController.h"
+#include "FlowFieldSubsystem.h"
+#include "NavigationSystem.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/Character/MultiShootGameCharacter.h"
+#include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
+#include "MultiShootGame/GameMode/MultiShootGameMatchInstance.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Proxy Tick"), STAT_EnemyProxyTick, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemy Proxies"), STAT_EnemyProxies, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemy Actors Active"), STAT_EnemyActorsActive, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemy Actors Pooled"), STAT_EnemyActorsPooled, STATGROUP_MultiShootGame);
+
+bool UEnemyProxySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyProxySubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyProxyTick);
+
+	if (GetWorld()->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	ActiveEnemies.RemoveAll([](const AMultiShootGameEnemyCharacter* Enemy)
+	{
+		return !IsValid(Enemy) || Enemy->GetHealthComponent()->bDied;
+	});
+
+	PooledEnemies.RemoveAll([](const AMultiShootGameEnemyCharacter* Enemy)
+	{
+		return !IsValid(Enemy);
+	});
+
+	TArray<FVector> PlayerLocations;
+	TArray<APawn*> PlayerTargets;
+	GetPlayerLocations(PlayerLocations, PlayerTargets);
+
+	MoveProxies(DeltaTime, PlayerLocations, PlayerTargets);
+
+	CurrentDemoteCheckTime += DeltaTime;
+	if (CurrentDemoteCheckTime >= DemoteCheckInterval)
+	{
+		DemoteFarEnemies(CurrentDemoteCheckTime, PlayerLocations, PlayerTargets);
+		CurrentDemoteCheckTime = 0.f;
+	}
+
+	SET_DWORD_STAT(STAT_EnemyProxies, Proxies.Num());
+	SET_DWORD_STAT(STAT_EnemyActorsActive, ActiveEnemies.Num());
+	SET_DWORD_STAT(STAT_EnemyActorsPooled, PooledEnemies.Num());
+}
+
+TStatId UEnemyProxySubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_EnemyProxyTick);
+}
+
+void UEnemyProxySubsystem::GetPlayerLocations(TArray<FVector>& OutLocations, TArray<APawn*>& OutTargets) const
+{
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		AMultiShootGameCharacter* Character = PlayerController
+			                                      ? Cast<AMultiShootGameCharacter>(PlayerController->GetPawn())
+			                                      : nullptr;
+		if (Character && !Character->GetHealthComponent()->bDied)
+		{
+			OutTargets.Add(Character);
+			OutLocations.Add(Character->GetActorLocation());
+		}
+	}
+}
+
+void UEnemyProxySubsystem::MoveProxies(float DeltaTime, const TArray<FVector>& PlayerLocations,
+                                       const TArray<APawn*>& PlayerTargets)
+{
+	UFlowFieldSubsystem* FlowFieldSubsystem = GetWorld()->GetSubsystem<UFlowFieldSubsystem>();
+
+	int Promotions = 0;
+	for (int i = Proxies.Num() - 1; i >= 0; i--)
+	{
+		FEnemyProxy& Proxy = Proxies[i];
+
+		int ClosestIndex = INDEX_NONE;
+		float ClosestDistanceSquared = MAX_FLT;
+		for (int j = 0; j < PlayerLocations.Num(); j++)
+		{
+			if (!AMultiShootGamePlayerState::IsSameMatch(Proxy.MatchInstance, PlayerTargets[j]))
+			{
+				continue;
+			}
+
+			const float DistanceSquared = FVector::DistSquared(Proxy.Location, PlayerLocations[j]);
+			if (DistanceSquared < ClosestDistanceSquared)
+			{
+				ClosestDistanceSquared = DistanceSquared;
+				ClosestIndex = j;
+			}
+		}
+
+		if (ClosestIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		if (ClosestDistanceSquared <= FMath::Square(PromoteDistance) && Promotions < MaxPromotionsPerFrame)
+		{
+			if (Promote(Proxy))
+			{
+				Promotions++;
+				Proxies.RemoveAtSwap(i, 1, false);
+			}
+			continue;
+		}
+
+		// Simplified movement: sample the shared flow field, otherwise head straight for the player
+		FVector Direction;
+		if (FlowFieldSubsystem == nullptr ||
+			!FlowFieldSubsystem->GetFlowDirection(PlayerTargets[ClosestIndex], Proxy.Location, Direction))
+		{
+			Direction = (PlayerLocations[ClosestIndex] - Proxy.Location).GetSafeNormal2D();
+		}
+
+		Proxy.Location += Direction * ProxySpeed * DeltaTime;
+		Proxy.Rotation = Direction.Rotation();
+	}
+}
+
+void UEnemyProxySubsystem::DemoteFarEnemies(float DeltaTime, const TArray<FVector>& PlayerLocations,
+                                            const TArray<APawn*>& PlayerTargets)
+{
+	if (PlayerLocations.Num() == 0)
+	{
+		return;
+	}
+
+	for (int i = ActiveEnemies.Num() - 1; i >= 0; i--)
+	{
+		AMultiShootGameEnemyCharacter* Enemy = ActiveEnemies[i];
+
+		bool bFar = true;
+		for (int j = 0; j < PlayerLocations.Num(); j++)
+		{
+			if (AMultiShootGamePlayerState::IsSameMatch(Enemy, PlayerTargets[j]) &&
+				FVector::DistSquared(Enemy->GetActorLocation(), PlayerLocations[j]) < FMath::Square(DemoteDistance))
+			{
+				bFar = false;
+				break;
+			}
+		}
+
+		if (!bFar)
+		{
+			FarTime.Remove(Enemy);
+			continue;
+		}
+
+		float& EnemyFarTime = FarTime.FindOrAdd(Enemy);
+		EnemyFarTime += DeltaTime;
+		if (EnemyFarTime >= DemoteDelay)
+		{
+			FarTime.Remove(Enemy);
+			ActiveEnemies.RemoveAtSwap(i, 1, false);
+			Demote(Enemy);
+		}
+	}
+}
+
+AMultiShootGameEnemyCharacter* UEnemyProxySubsystem::Promote(const FEnemyProxy& Proxy)
+{
+	FVector Location = Proxy.Location;
+
+	const UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	FNavLocation NavLocation;
+	if (NavigationSystem && NavigationSystem->ProjectPointToNavigation(Location, NavLocation))
+	{
+		Location = NavLocation.Location;
+	}
+
+	AMultiShootGameEnemyCharacter* Enemy = nullptr;
+
+	const int PooledIndex = PooledEnemies.IndexOfByPredicate([&Proxy](const AMultiShootGameEnemyCharacter* TempEnemy)
+	{
+		// Pooled actors keep the collision exclusions of their match, so they are only reused within it
+		return TempEnemy->GetClass() == Proxy.EnemyClass && TempEnemy->GetMatchInstance() == Proxy.MatchInstance;
+	});
+
+	if (PooledIndex != INDEX_NONE)
+	{
+		Enemy = PooledEnemies[PooledIndex];
+		PooledEnemies.RemoveAtSwap(PooledIndex, 1, false);
+
+		Location.Z += Enemy->GetDefaultHalfHeight();
+		Enemy->SetActorLocationAndRotation(Location, FRotator(0, Proxy.Rotation.Yaw, 0), false, nullptr,
+		                                   ETeleportType::ResetPhysics);
+		Enemy->SetPooled(false);
+	}
+	else
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride =
+			ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+		Location.Z += Proxy.EnemyClass->GetDefaultObject<AMultiShootGameEnemyCharacter>()->GetDefaultHalfHeight();
+		Enemy = GetWorld()->SpawnActor<AMultiShootGameEnemyCharacter>(Proxy.EnemyClass, Location,
+		                                                              FRotator(0, Proxy.Rotation.Yaw, 0),
+		                                                              SpawnParameters);
+		if (Enemy == nullptr)
+		{
+			return nullptr;
+		}
+
+		if (Enemy->GetController() == nullptr)
+		{
+			Enemy->SpawnDefaultController();
+		}
+	}
+
+	// A recycled actor still carries the health of the bot that used it last
+	UHealthComponent* HealthComponent = Enemy->GetHealthComponent();
+	HealthComponent->bDied = false;
+	HealthComponent->SetHealth(Proxy.Health > 0.f ? Proxy.Health : HealthComponent->GetDefaultHealth());
+
+	ActiveEnemies.AddUnique(Enemy);
+
+	if (Proxy.MatchInstance)
+	{
+		Proxy.MatchInstance->AddBot(Enemy);
+	}
+
+	return Enemy;
+}
+
+void UEnemyProxySubsystem::Demote(AMultiShootGameEnemyCharacter* Enemy)
+{
+	FEnemyProxy Proxy;
+	Proxy.EnemyClass = Enemy->GetClass();
+	Proxy.Location = Enemy->GetActorLocation() - FVector(0, 0, Enemy->GetDefaultHalfHeight());
+	Proxy.Rotation = Enemy->GetActorRotation();
+	Proxy.Health = Enemy->GetHealthComponent()->GetHealth();
+	Proxy.MatchInstance = Enemy->GetMatchInstance();
+	Proxies.Add(Proxy);
+
+	Enemy->SetPooled(true);
+	PooledEnemies.Add(Enemy);
+}
+
+void UEnemyProxySubsystem::SpawnEnemy(TSubclassOf<AMultiShootGameEnemyCharacter> EnemyClass, FVector Location,
+                                      FRotator Rotation, AMultiShootGameMatchInstance* MatchInstance)
+{
+	if (EnemyClass == nullptr)
+	{
+		return;
+	}
+
+	FEnemyProxy Proxy;
+	Proxy.EnemyClass = EnemyClass;
+	Proxy.Location = Location;
+	Proxy.Rotation = Rotation;
+	Proxy.MatchInstance = MatchInstance;
+
+	TArray<FVector> PlayerLocations;
+	TArray<APawn*> PlayerTargets;
+	GetPlayerLocations(PlayerLocations, PlayerTargets);
+
+	for (int i = 0; i < PlayerLocations.Num(); i++)
+	{
+		if (AMultiShootGamePlayerState::IsSameMatch(MatchInstance, PlayerTargets[i]) &&
+			FVector::DistSquared(Location, PlayerLocations[i]) <= FMath::Square(PromoteDistance))
+		{
+			Promote(Proxy);
+			return;
+		}
+	}
+
+	Proxies.Add(Proxy);
+}
+
+void UEnemyProxySubsystem::RegisterEnemy(AMultiShootGameEnemyCharacter* Enemy)
+{
+	if (!PooledEnemies.Contains(Enemy))
+	{
+		ActiveEnemies.AddUnique(Enemy);
+	}
+}
+
+int UEnemyProxySubsystem::GetNumProxiesInMatch(const AMultiShootGameMatchInstance* MatchInstance) const
+{
+	int Count = 0;
+	for (const FEnemyProxy& Proxy : Proxies)
+	{
+		if (Proxy.MatchInstance == MatchInstance)
+		{
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+void UEnemyProxySubsystem::RemoveProxiesInMatch(const AMultiShootGameMatchInstance* MatchInstance)
+{
+	Proxies.RemoveAll([MatchInstance](const FEnemyProxy& Proxy)
+	{
+		return Proxy.MatchInstance == MatchInstance;
+	});
+}
+
+void UEnemyProxySubsystem::UnregisterEnemy(AMultiShootGameEnemyCharacter* Enemy)
+{
+	ActiveEnemies.Remove(Enemy);
+	PooledEnemies.Remove(Enemy);
+	FarTime.Remove(Enemy);
+}
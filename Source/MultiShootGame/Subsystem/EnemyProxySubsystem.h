@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiShootGameTickableWorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "EnemyProxySubsystem.generated.h"
+
+class AMultiShootGameEnemyCharacter;
+class AMultiShootGameMatchInstance;
+
+/**
+ * A bot that is currently represented without an actor.
+ */
+USTRUCT()
+struct FEnemyProxy
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+	TSubclassOf<AMultiShootGameEnemyCharacter> EnemyClass;
+
+	UPROPERTY()
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** Zero for bots that have never been promoted, which start at full health. */
+	UPROPERTY()
+	float Health = 0.f;
+
+	/** Hosted match the bot belongs to, null outside AMultiShootGameServerGameMode. */
+	UPROPERTY()
+	AMultiShootGameMatchInstance* MatchInstance = nullptr;
+};
+
+/**
+ * Hybrid enemy representation. Bots far from every player live as plain structs with flow-field movement and no
+ * actor, and are promoted to pooled full actors once a player is within engagement range.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UEnemyProxySubsystem : public UMultiShootGameTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	float PromoteDistance = 4000.f;
+
+	UPROPERTY(Config)
+	float DemoteDistance = 6000.f;
+
+	UPROPERTY(Config)
+	float DemoteDelay = 3.f;
+
+	UPROPERTY(Config)
+	float ProxySpeed = 300.f;
+
+	UPROPERTY(Config)
+	int MaxPromotionsPerFrame = 2;
+
+	UPROPERTY(Config)
+	float DemoteCheckInterval = 0.5f;
+
+	UPROPERTY()
+	TArray<FEnemyProxy> Proxies;
+
+	UPROPERTY()
+	TArray<AMultiShootGameEnemyCharacter*> ActiveEnemies;
+
+	UPROPERTY()
+	TArray<AMultiShootGameEnemyCharacter*> PooledEnemies;
+
+	TMap<TObjectKey<AMultiShootGameEnemyCharacter>, float> FarTime;
+
+	float CurrentDemoteCheckTime = 0.f;
+
+	void GetPlayerLocations(TArray<FVector>& OutLocations, TArray<APawn*>& OutTargets) const;
+
+	void MoveProxies(float DeltaTime, const TArray<FVector>& PlayerLocations, const TArray<APawn*>& PlayerTargets);
+
+	void DemoteFarEnemies(float DeltaTime, const TArray<FVector>& PlayerLocations, const TArray<APawn*>& PlayerTargets);
+
+	AMultiShootGameEnemyCharacter* Promote(const FEnemyProxy& Proxy);
+
+	void Demote(AMultiShootGameEnemyCharacter* Enemy);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Adds a bot as a proxy, or as a full actor straight away when a player of its match is already in engagement
+	 * range. Proxies only chase and wake up for players of their own match.
+	 */
+	UFUNCTION(BlueprintCallable, Category = EnemyProxy)
+	void SpawnEnemy(TSubclassOf<AMultiShootGameEnemyCharacter> EnemyClass, FVector Location, FRotator Rotation,
+	                AMultiShootGameMatchInstance* MatchInstance = nullptr);
+
+	/** Lets an enemy spawned elsewhere be demoted when it drifts out of range. */
+	void RegisterEnemy(AMultiShootGameEnemyCharacter* Enemy);
+
+	void UnregisterEnemy(AMultiShootGameEnemyCharacter* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = EnemyProxy)
+	FORCEINLINE int GetNumProxies() const { return Proxies.Num(); }
+
+	int GetNumProxiesInMatch(const AMultiShootGameMatchInstance* MatchInstance) const;
+
+	/** Drops the proxies of a hosted match that has ended. */
+	void RemoveProxiesInMatch(const AMultiShootGameMatchInstance* MatchInstance);
+
+	UFUNCTION(BlueprintPure, Category = EnemyProxy)
+	FORCEINLINE int GetNumPooled() const { return PooledEnemies.Num(); }
+};
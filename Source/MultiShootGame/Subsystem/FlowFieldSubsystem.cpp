@@ -0,0 +1,274 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "FlowFieldSubsystem.h"
+#include "NavigationSystem.h"
+#include "MultiShootGame/MultiShootGame.h"
+
+DECLARE_CYCLE_STAT(TEXT("Flow Field Tick"), STAT_FlowFieldTick, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Flow Field Cells Built"), STAT_FlowFieldCellsBuilt, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Flow Field Count"), STAT_FlowFieldCount, STATGROUP_MultiShootGame);
+
+static const FIntPoint FlowFieldNeighbors[] = {
+	FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1),
+	FIntPoint(1, 1), FIntPoint(1, -1), FIntPoint(-1, 1), FIntPoint(-1, -1)
+};
+
+bool UFlowFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFlowFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld);
+	if (NavigationSystem)
+	{
+		NavigationSystem->OnNavigationGenerationFinishedDelegate.AddDynamic(
+			this, &UFlowFieldSubsystem::OnNavigationGenerationFinished);
+	}
+}
+
+void UFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlowFieldTick);
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	for (auto It = Fields.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Target.IsValid() || CurrentTime - It.Value().LastSampleTime > FieldTimeout)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_FlowFieldCount, Fields.Num());
+
+	TArray<FFlowField*> BuildingFields;
+	for (auto& Pair : Fields)
+	{
+		FFlowField& Field = Pair.Value;
+
+		// A build always runs to completion, so a target that moves faster than a build still gets fresh fields. The
+		// last completed field stays usable meanwhile, and the next build starts from wherever the target is then.
+		if (!Field.bBuilding)
+		{
+			const FIntPoint TargetCell = GetCell(Field.Target->GetActorLocation());
+			if (TargetCell != Field.TargetCell)
+			{
+				StartBuild(Field, TargetCell);
+			}
+		}
+
+		if (Field.bBuilding)
+		{
+			BuildingFields.Add(&Field);
+		}
+	}
+
+	// Every building field gets an equal share, starting from a different field each frame. Cells left over by fields
+	// that finish early go round again.
+	int RemainingCells = MaxCellsPerFrame;
+	if (BuildingFields.Num() > 0)
+	{
+		const int CellsPerField = FMath::Max(MaxCellsPerFrame / BuildingFields.Num(), 1);
+
+		int FieldIndex = NextBuildFieldIndex % BuildingFields.Num();
+		NextBuildFieldIndex = FieldIndex + 1;
+
+		while (RemainingCells > 0 && BuildingFields.Num() > 0)
+		{
+			FieldIndex %= BuildingFields.Num();
+
+			FFlowField* Field = BuildingFields[FieldIndex];
+			RemainingCells -= ContinueBuild(*Field, FMath::Min(CellsPerField, RemainingCells));
+
+			if (Field->bBuilding)
+			{
+				FieldIndex++;
+			}
+			else
+			{
+				BuildingFields.RemoveAt(FieldIndex);
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_FlowFieldCellsBuilt, MaxCellsPerFrame - RemainingCells);
+}
+
+TStatId UFlowFieldSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_FlowFieldTick);
+}
+
+FIntPoint UFlowFieldSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+FVector UFlowFieldSubsystem::GetCellCenter(const FIntPoint& Cell) const
+{
+	return FVector((Cell.X + 0.5f) * CellSize, (Cell.Y + 0.5f) * CellSize, 0.f);
+}
+
+UFlowFieldSubsystem::FFlowCell UFlowFieldSubsystem::FindOrProjectCell(const FIntPoint& Cell, float ReferenceHeight)
+{
+	if (const FFlowCell* CachedCell = Cells.Find(Cell))
+	{
+		return *CachedCell;
+	}
+
+	FFlowCell NewCell;
+
+	const UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (NavigationSystem)
+	{
+		FVector CellCenter = GetCellCenter(Cell);
+		CellCenter.Z = ReferenceHeight;
+
+		FNavLocation NavLocation;
+		NewCell.bWalkable = NavigationSystem->ProjectPointToNavigation(
+			CellCenter, NavLocation, FVector(CellSize * 0.5f, CellSize * 0.5f, ProjectHeight));
+		NewCell.Height = NewCell.bWalkable ? NavLocation.Location.Z : ReferenceHeight;
+	}
+
+	Cells.Add(Cell, NewCell);
+
+	return NewCell;
+}
+
+bool UFlowFieldSubsystem::CanStep(const FIntPoint& From, const FIntPoint& To)
+{
+	const FFlowCell FromCell = FindOrProjectCell(From, 0.f);
+	const FFlowCell ToCell = FindOrProjectCell(To, FromCell.Height);
+
+	return ToCell.bWalkable && FMath::Abs(ToCell.Height - FromCell.Height) <= MaxHeightDelta;
+}
+
+void UFlowFieldSubsystem::StartBuild(FFlowField& Field, const FIntPoint& TargetCell)
+{
+	Field.bBuilding = true;
+	Field.PendingTargetCell = TargetCell;
+	Field.PendingIntegration.Reset();
+	Field.PendingFrontier.Reset();
+	Field.PendingFrontierIndex = 0;
+
+	// Cells are 2D, so a cell projected at one height is reused on every floor above or below it
+	FindOrProjectCell(TargetCell, Field.Target->GetActorLocation().Z);
+
+	Field.PendingIntegration.Add(TargetCell, 0);
+	Field.PendingFrontier.Add(TargetCell);
+}
+
+int UFlowFieldSubsystem::ContinueBuild(FFlowField& Field, int MaxCells)
+{
+	int Count = 0;
+	while (Field.PendingFrontierIndex < Field.PendingFrontier.Num() && Count < MaxCells)
+	{
+		const FIntPoint Cell = Field.PendingFrontier[Field.PendingFrontierIndex++];
+		const uint16 Cost = Field.PendingIntegration.FindChecked(Cell);
+		Count++;
+
+		if (Cost >= MaxFieldRadius)
+		{
+			continue;
+		}
+
+		for (int i = 0; i < 4; i++)
+		{
+			const FIntPoint Neighbor = Cell + FlowFieldNeighbors[i];
+			if (!Field.PendingIntegration.Contains(Neighbor) && CanStep(Cell, Neighbor))
+			{
+				Field.PendingIntegration.Add(Neighbor, Cost + 1);
+				Field.PendingFrontier.Add(Neighbor);
+			}
+		}
+	}
+
+	if (Field.PendingFrontierIndex >= Field.PendingFrontier.Num())
+	{
+		Field.Integration = MoveTemp(Field.PendingIntegration);
+		Field.TargetCell = Field.PendingTargetCell;
+		Field.PendingFrontier.Empty();
+		Field.bBuilding = false;
+	}
+
+	return Count;
+}
+
+bool UFlowFieldSubsystem::GetFlowDirection(const APawn* Target, const FVector& Location, FVector& OutDirection)
+{
+	if (Target == nullptr)
+	{
+		return false;
+	}
+
+	FFlowField& Field = Fields.FindOrAdd(Target);
+	Field.Target = const_cast<APawn*>(Target);
+	Field.LastSampleTime = GetWorld()->GetTimeSeconds();
+
+	const FIntPoint Cell = GetCell(Location);
+	const uint16* Cost = Field.Integration.Find(Cell);
+	if (Cost == nullptr)
+	{
+		return false;
+	}
+
+	if (*Cost == 0)
+	{
+		OutDirection = (Target->GetActorLocation() - Location).GetSafeNormal2D();
+		return true;
+	}
+
+	FIntPoint BestCell = Cell;
+	uint16 BestCost = *Cost;
+	for (const FIntPoint& Offset : FlowFieldNeighbors)
+	{
+		const uint16* NeighborCost = Field.Integration.Find(Cell + Offset);
+		if (NeighborCost == nullptr || *NeighborCost >= BestCost)
+		{
+			continue;
+		}
+
+		// Diagonal moves must not cut across a blocked corner
+		if (Offset.X != 0 && Offset.Y != 0 &&
+			(!Field.Integration.Contains(Cell + FIntPoint(Offset.X, 0)) ||
+				!Field.Integration.Contains(Cell + FIntPoint(0, Offset.Y))))
+		{
+			continue;
+		}
+
+		BestCell = Cell + Offset;
+		BestCost = *NeighborCost;
+	}
+
+	if (BestCell == Cell)
+	{
+		return false;
+	}
+
+	OutDirection = (GetCellCenter(BestCell) - Location).GetSafeNormal2D();
+
+	return true;
+}
+
+void UFlowFieldSubsystem::InvalidateFields()
+{
+	Cells.Reset();
+
+	for (auto& Pair : Fields)
+	{
+		Pair.Value.TargetCell = FIntPoint(MAX_int32, MAX_int32);
+		Pair.Value.bBuilding = false;
+	}
+}
+
+void UFlowFieldSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+	UE_LOG(LogMultiShootGame, Verbose, TEXT("Flow field: navigation rebuilt, invalidating %d fields"), Fields.Num());
+
+	InvalidateFields();
+}
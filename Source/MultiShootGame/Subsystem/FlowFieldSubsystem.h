@@ -0,0 +1,104 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiShootGameTickableWorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FlowFieldSubsystem.generated.h"
+
+class ANavigationData;
+
+/**
+ * Per-target flow fields over the navmesh. Many bots chasing the same player sample a shared integration field
+ * instead of running their own path queries. When the target changes cell the whole field is rebuilt with a
+ * breadth-first pass time-sliced over several frames, sharing the per-frame cell budget round-robin. Cells are 2D,
+ * so fields assume a single walkable floor per cell.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UFlowFieldSubsystem : public UMultiShootGameTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	float CellSize = 200.f;
+
+	UPROPERTY(Config)
+	int MaxFieldRadius = 60;
+
+	UPROPERTY(Config)
+	int MaxCellsPerFrame = 2000;
+
+	UPROPERTY(Config)
+	float MaxHeightDelta = 100.f;
+
+	UPROPERTY(Config)
+	float ProjectHeight = 500.f;
+
+	UPROPERTY(Config)
+	float FieldTimeout = 5.f;
+
+	struct FFlowCell
+	{
+		bool bWalkable = false;
+
+		float Height = 0.f;
+	};
+
+	struct FFlowField
+	{
+		TWeakObjectPtr<APawn> Target;
+
+		FIntPoint TargetCell = FIntPoint(MAX_int32, MAX_int32);
+
+		TMap<FIntPoint, uint16> Integration;
+
+		TMap<FIntPoint, uint16> PendingIntegration;
+
+		TArray<FIntPoint> PendingFrontier;
+
+		int PendingFrontierIndex = 0;
+
+		FIntPoint PendingTargetCell = FIntPoint(MAX_int32, MAX_int32);
+
+		bool bBuilding = false;
+
+		double LastSampleTime = 0.0;
+	};
+
+	TMap<FIntPoint, FFlowCell> Cells;
+
+	TMap<TObjectKey<APawn>, FFlowField> Fields;
+
+	int NextBuildFieldIndex = 0;
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	FVector GetCellCenter(const FIntPoint& Cell) const;
+
+	FFlowCell FindOrProjectCell(const FIntPoint& Cell, float ReferenceHeight);
+
+	bool CanStep(const FIntPoint& From, const FIntPoint& To);
+
+	void StartBuild(FFlowField& Field, const FIntPoint& TargetCell);
+
+	int ContinueBuild(FFlowField& Field, int MaxCells);
+
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData* NavData);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** Direction to move from Location towards Target. Returns false until a field for Target is available. */
+	bool GetFlowDirection(const APawn* Target, const FVector& Location, FVector& OutDirection);
+
+	void InvalidateFields();
+};
@@ -0,0 +1,200 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "FrameBudgetSubsystem.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "CoreGlobals.h"
+#include "EngineUtils.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/Character/MultiShootGameEnemyCharacter.h"
+
+bool UFrameBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFrameBudgetSubsystem::Deinitialize()
+{
+	DeferredCosmetics.Empty();
+
+	Super::Deinitialize();
+}
+
+void UFrameBudgetSubsystem::Tick(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (World == nullptr || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	// The engine's game-thread time of the last frame, which leaves out idling for the max tick rate
+	const float FrameTimeMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	GameThreadTimeMs = FMath::Lerp(GameThreadTimeMs, FrameTimeMs, 0.2f);
+
+	if (GameThreadTimeMs > FrameBudgetMs)
+	{
+		OverBudgetTime += DeltaTime;
+		UnderBudgetTime = 0.f;
+
+		if (OverBudgetTime >= EscalateDelay && BudgetLevel != EFrameBudgetLevel::ThrottledSpawn)
+		{
+			OverBudgetTime = 0.f;
+			SetBudgetLevel(static_cast<EFrameBudgetLevel>(static_cast<uint8>(BudgetLevel) + 1));
+		}
+	}
+	else if (GameThreadTimeMs < FrameBudgetMs * RecoverRatio)
+	{
+		UnderBudgetTime += DeltaTime;
+		OverBudgetTime = 0.f;
+
+		if (UnderBudgetTime >= RecoverDelay && BudgetLevel != EFrameBudgetLevel::Normal)
+		{
+			UnderBudgetTime = 0.f;
+			SetBudgetLevel(static_cast<EFrameBudgetLevel>(static_cast<uint8>(BudgetLevel) - 1));
+		}
+	}
+
+	// Bots spawned since the last change have to pick up the current level
+	CurrentApplyTime += DeltaTime;
+	if (CurrentApplyTime >= ApplyInterval && BudgetLevel != EFrameBudgetLevel::Normal)
+	{
+		CurrentApplyTime = 0.f;
+		ApplyBudgetLevel();
+	}
+
+	FlushDeferredCosmetics();
+}
+
+TStatId UFrameBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFrameBudgetSubsystem, STATGROUP_Tickables);
+}
+
+void UFrameBudgetSubsystem::SetBudgetLevel(EFrameBudgetLevel NewLevel)
+{
+	if (BudgetLevel == NewLevel)
+	{
+		return;
+	}
+
+	UE_LOG(LogMultiShootGame, Log, TEXT("Frame budget: %s -> %s (game thread %.2f ms, budget %.2f ms)"),
+	       *UEnum::GetValueAsString(BudgetLevel), *UEnum::GetValueAsString(NewLevel), GameThreadTimeMs,
+	       FrameBudgetMs);
+
+	BudgetLevel = NewLevel;
+	CurrentApplyTime = 0.f;
+
+	ApplyBudgetLevel();
+}
+
+void UFrameBudgetSubsystem::ApplyBudgetLevel()
+{
+	ApplyNetUpdateFrequency(BudgetLevel >= EFrameBudgetLevel::ReducedNetUpdate);
+
+	ApplyAITickInterval(BudgetLevel >= EFrameBudgetLevel::StretchedAI);
+}
+
+void UFrameBudgetSubsystem::ApplyNetUpdateFrequency(bool bReduce) const
+{
+	TArray<FVector> PlayerLocations;
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController && PlayerController->GetPawn())
+		{
+			PlayerLocations.Add(PlayerController->GetPawn()->GetActorLocation());
+		}
+	}
+
+	for (TActorIterator<AMultiShootGameEnemyCharacter> It(GetWorld()); It; ++It)
+	{
+		const float DefaultNetUpdateFrequency = It->GetClass()->GetDefaultObject<AActor>()->NetUpdateFrequency;
+
+		bool bLowSignificance = bReduce;
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			if (FVector::DistSquared(PlayerLocation, It->GetActorLocation()) <
+				FMath::Square(LowSignificanceDistance))
+			{
+				bLowSignificance = false;
+				break;
+			}
+		}
+
+		It->NetUpdateFrequency = bLowSignificance
+			                         ? FMath::Min(ReducedNetUpdateFrequency, DefaultNetUpdateFrequency)
+			                         : DefaultNetUpdateFrequency;
+	}
+}
+
+void UFrameBudgetSubsystem::ApplyAITickInterval(bool bStretch) const
+{
+	for (TActorIterator<AAIController> It(GetWorld()); It; ++It)
+	{
+		if (Cast<AMultiShootGameEnemyCharacter>(It->GetPawn()) == nullptr)
+		{
+			continue;
+		}
+
+		const float DefaultTickInterval = It->GetClass()->GetDefaultObject<AActor>()->PrimaryActorTick.TickInterval;
+		const float TickInterval = bStretch
+			                           ? FMath::Max(StretchedAITickInterval, DefaultTickInterval)
+			                           : DefaultTickInterval;
+
+		It->SetActorTickInterval(TickInterval);
+
+		if (It->BrainComponent)
+		{
+			const UActorComponent* DefaultBrain = It->BrainComponent->GetClass()->GetDefaultObject<UActorComponent>();
+			const float DefaultBrainTickInterval = DefaultBrain->PrimaryComponentTick.TickInterval;
+			It->BrainComponent->SetComponentTickInterval(
+				bStretch ? FMath::Max(StretchedAITickInterval, DefaultBrainTickInterval) : DefaultBrainTickInterval);
+		}
+	}
+}
+
+void UFrameBudgetSubsystem::FlushDeferredCosmetics()
+{
+	if (DeferredCosmetics.Num() == 0)
+	{
+		return;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	const int MaxCount = IsCosmeticDeferred() ? MaxDeferredCosmeticsPerFrame : DeferredCosmetics.Num();
+
+	int Count = 0;
+	int Dropped = 0;
+	for (; Count < DeferredCosmetics.Num() && Count - Dropped < MaxCount; Count++)
+	{
+		if (CurrentTime - DeferredCosmetics[Count].QueuedTime > MaxCosmeticDelay)
+		{
+			Dropped++;
+			continue;
+		}
+
+		DeferredCosmetics[Count].Work();
+	}
+
+	DeferredCosmetics.RemoveAt(0, Count, false);
+
+	if (Dropped > 0)
+	{
+		UE_LOG(LogMultiShootGame, Verbose, TEXT("Frame budget: dropped %d stale cosmetic events"), Dropped);
+	}
+}
+
+void UFrameBudgetSubsystem::RunCosmetic(const UObject* WorldContextObject, TFunction<void()>&& Work)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UFrameBudgetSubsystem* FrameBudgetSubsystem = World ? World->GetSubsystem<UFrameBudgetSubsystem>() : nullptr;
+
+	if (FrameBudgetSubsystem && FrameBudgetSubsystem->IsCosmeticDeferred())
+	{
+		FrameBudgetSubsystem->DeferredCosmetics.Add({FPlatformTime::Seconds(), MoveTemp(Work)});
+		return;
+	}
+
+	Work();
+}
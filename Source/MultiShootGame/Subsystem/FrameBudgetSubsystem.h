@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiShootGameTickableWorldSubsystem.h"
+#include "MultiShootGame/Enum/EFrameBudgetLevel.h"
+#include "FrameBudgetSubsystem.generated.h"
+
+/**
+ * Server frame-budget governor. Measures game-thread time per frame and, while over budget, degrades in a
+ * fixed order: net update rate of distant enemies, cosmetic work, AI tick intervals, then bot spawning.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UFrameBudgetSubsystem : public UMultiShootGameTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	float FrameBudgetMs = 25.f;
+
+	UPROPERTY(Config)
+	float RecoverRatio = 0.8f;
+
+	UPROPERTY(Config)
+	float EscalateDelay = 0.5f;
+
+	UPROPERTY(Config)
+	float RecoverDelay = 3.f;
+
+	UPROPERTY(Config)
+	float ApplyInterval = 1.f;
+
+	UPROPERTY(Config)
+	float LowSignificanceDistance = 3000.f;
+
+	UPROPERTY(Config)
+	float ReducedNetUpdateFrequency = 5.f;
+
+	UPROPERTY(Config)
+	float StretchedAITickInterval = 0.2f;
+
+	UPROPERTY(Config)
+	int MaxDeferredCosmeticsPerFrame = 8;
+
+	UPROPERTY(Config)
+	float MaxCosmeticDelay = 0.25f;
+
+	EFrameBudgetLevel BudgetLevel = EFrameBudgetLevel::Normal;
+
+	float GameThreadTimeMs = 0.f;
+
+	float OverBudgetTime = 0.f;
+
+	float UnderBudgetTime = 0.f;
+
+	float CurrentApplyTime = 0.f;
+
+	struct FDeferredCosmetic
+	{
+		double QueuedTime;
+
+		TFunction<void()> Work;
+	};
+
+	TArray<FDeferredCosmetic> DeferredCosmetics;
+
+	void SetBudgetLevel(EFrameBudgetLevel NewLevel);
+
+	void ApplyBudgetLevel();
+
+	void ApplyNetUpdateFrequency(bool bReduce) const;
+
+	void ApplyAITickInterval(bool bStretch) const;
+
+	void FlushDeferredCosmetics();
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	FORCEINLINE EFrameBudgetLevel GetBudgetLevel() const { return BudgetLevel; }
+
+	FORCEINLINE float GetGameThreadTimeMs() const { return GameThreadTimeMs; }
+
+	FORCEINLINE bool IsCosmeticDeferred() const { return BudgetLevel >= EFrameBudgetLevel::DeferredCosmetics; }
+
+	FORCEINLINE bool IsSpawnThrottled() const { return BudgetLevel >= EFrameBudgetLevel::ThrottledSpawn; }
+
+	/** Runs Work now, or queues it while cosmetics are deferred. Queued work older than MaxCosmeticDelay is dropped. */
+	static void RunCosmetic(const UObject* WorldContextObject, TFunction<void()>&& Work);
+};
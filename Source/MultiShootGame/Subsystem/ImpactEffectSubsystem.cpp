@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ImpactEffectSubsystem.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/ParticleSystem/ImpactParticleSystem.h"
+#include "MultiShootGame/ParticleSystem/ParticleSystemPool.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Effects Active"), STAT_ImpactEffectsActive, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Effects Pooled"), STAT_ImpactEffectsPooled, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Effects Stolen"), STAT_ImpactEffectsStolen, STATGROUP_MultiShootGame);
+
+bool UImpactEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UImpactEffectSubsystem::Deinitialize()
+{
+	for (const TPair<TSubclassOf<AImpactParticleSystem>, UParticleSystemPool*>& Pair : Pools)
+	{
+		Pair.Value->ReleaseAll();
+	}
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+UParticleSystemPool* UImpactEffectSubsystem::FindOrCreatePool(TSubclassOf<AImpactParticleSystem> EffectClass)
+{
+	if (EffectClass == nullptr || GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return nullptr;
+	}
+
+	UParticleSystemPool** ExistingPool = Pools.Find(EffectClass);
+	if (ExistingPool)
+	{
+		return *ExistingPool;
+	}
+
+	// The class defaults describe the effect, the actor itself is never spawned
+	const AImpactParticleSystem* ImpactEffect = GetDefault<AImpactParticleSystem>(EffectClass);
+
+	UParticleSystemPool* Pool = NewObject<UParticleSystemPool>(this);
+	Pool->InitializePool(ImpactEffect->GetParticleTemplate(), MaxActivePerEffect, PrewarmPerEffect);
+	Pool->SetCollisionDecal(ImpactEffect->GetDecalMaterial(), ImpactEffect->GetDecalSize());
+
+	Pools.Add(EffectClass, Pool);
+
+	return Pool;
+}
+
+void UImpactEffectSubsystem::PlayImpactEffect(TSubclassOf<AImpactParticleSystem> EffectClass, FVector Location,
+                                              FRotator Rotation)
+{
+	UParticleSystemPool* Pool = FindOrCreatePool(EffectClass);
+	if (Pool)
+	{
+		Pool->Play(Location, Rotation);
+
+		UpdateStats();
+	}
+}
+
+void UImpactEffectSubsystem::PrewarmImpactEffect(TSubclassOf<AImpactParticleSystem> EffectClass)
+{
+	FindOrCreatePool(EffectClass);
+}
+
+void UImpactEffectSubsystem::UpdateStats() const
+{
+	int NumActive = 0;
+	int NumPooled = 0;
+	int NumStolen = 0;
+	for (const TPair<TSubclassOf<AImpactParticleSystem>, UParticleSystemPool*>& Pair : Pools)
+	{
+		NumActive += Pair.Value->GetNumActive();
+		NumPooled += Pair.Value->GetNumFree();
+		NumStolen += Pair.Value->GetNumStolen();
+	}
+
+	SET_DWORD_STAT(STAT_ImpactEffectsActive, NumActive);
+	SET_DWORD_STAT(STAT_ImpactEffectsPooled, NumPooled);
+	SET_DWORD_STAT(STAT_ImpactEffectsStolen, NumStolen);
+}
@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ImpactEffectSubsystem.generated.h"
+
+class AImpactParticleSystem;
+class UParticleSystemPool;
+
+/**
+ * Plays impact effects from per-effect emitter pools built from the AImpactParticleSystem defaults, so hits
+ * never spawn actors at runtime.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UImpactEffectSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	int MaxActivePerEffect = 24;
+
+	UPROPERTY(Config)
+	int PrewarmPerEffect = 4;
+
+	UPROPERTY()
+	TMap<TSubclassOf<AImpactParticleSystem>, UParticleSystemPool*> Pools;
+
+	UParticleSystemPool* FindOrCreatePool(TSubclassOf<AImpactParticleSystem> EffectClass);
+
+	void UpdateStats() const;
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Deinitialize() override;
+
+	void PlayImpactEffect(TSubclassOf<AImpactParticleSystem> EffectClass, FVector Location, FRotator Rotation);
+
+	/** Creates the pools up front so the first hits of a match don't allocate components. */
+	void PrewarmImpactEffect(TSubclassOf<AImpactParticleSystem> EffectClass);
+};
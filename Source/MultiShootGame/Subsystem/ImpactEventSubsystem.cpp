@@ -0,0 +1,181 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ImpactEventSubsystem.h"
+#include "DecalManagerSubsystem.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/Character/MultiShootGameCharacter.h"
+#include "MultiShootGame/Component/HitEffectComponent.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
+#include "MultiShootGame/Interface/MultiShootGameImpactSource.h"
+
+DECLARE_CYCLE_STAT(TEXT("Impact Events Send"), STAT_ImpactEventsSend, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Impact Events Recorded"), STAT_ImpactEventsRecorded, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Impact Events Sent"), STAT_ImpactEventsSent, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Impact Event Messages"), STAT_ImpactEventMessages, STATGROUP_MultiShootGame);
+
+bool UImpactEventSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UImpactEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+		this, &UImpactEventSubsystem::OnWorldPostActorTick);
+}
+
+void UImpactEventSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	RecordedImpacts.Empty();
+
+	Super::Deinitialize();
+}
+
+void UImpactEventSubsystem::AddImpact(const AActor* Source, FVector Location, FVector Normal, FVector Direction,
+                                      EPhysicalSurface SurfaceType, bool bSpawnDecal)
+{
+	if (Source == nullptr || GetWorld()->GetNetMode() == NM_Client ||
+		!Source->GetClass()->ImplementsInterface(UMultiShootGameImpactSource::StaticClass()))
+	{
+		return;
+	}
+
+	FRecordedImpact& RecordedImpact = RecordedImpacts.AddDefaulted_GetRef();
+	RecordedImpact.ImpactEvent.Location = Location;
+	RecordedImpact.ImpactEvent.Normal = Normal.GetSafeNormal();
+	RecordedImpact.ImpactEvent.Direction = Direction.GetSafeNormal();
+	RecordedImpact.ImpactEvent.SurfaceType = SurfaceType;
+	RecordedImpact.ImpactEvent.SourceClass = Source->GetClass();
+	RecordedImpact.ImpactEvent.bSpawnDecal = bSpawnDecal;
+
+	RecordedImpact.MatchInstanceId = AMultiShootGamePlayerState::FindMatchInstanceId(Source);
+
+	INC_DWORD_STAT(STAT_ImpactEventsRecorded);
+}
+
+void UImpactEventSubsystem::RecordImpact(const AActor* Source, FVector Location, FVector Normal, FVector Direction,
+                                         EPhysicalSurface SurfaceType, bool bSpawnDecal)
+{
+	const UWorld* World = Source ? Source->GetWorld() : nullptr;
+	UImpactEventSubsystem* ImpactEventSubsystem = World ? World->GetSubsystem<UImpactEventSubsystem>() : nullptr;
+
+	if (ImpactEventSubsystem)
+	{
+		ImpactEventSubsystem->AddImpact(Source, Location, Normal, Direction, SurfaceType, bSpawnDecal);
+	}
+}
+
+void UImpactEventSubsystem::OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld() || RecordedImpacts.Num() == 0)
+	{
+		return;
+	}
+
+	const ENetMode NetMode = InWorld->GetNetMode();
+
+	// A dedicated server never renders, listen and standalone servers play the batch for their own player
+	if (NetMode != NM_DedicatedServer)
+	{
+		for (const FRecordedImpact& RecordedImpact : RecordedImpacts)
+		{
+			PlayImpactEvent(RecordedImpact.ImpactEvent);
+		}
+	}
+
+	if (NetMode == NM_DedicatedServer || NetMode == NM_ListenServer)
+	{
+		SendImpactEvents();
+	}
+
+	RecordedImpacts.Reset();
+}
+
+void UImpactEventSubsystem::SendImpactEvents()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ImpactEventsSend);
+
+	const float RelevancyDistanceSquared = FMath::Square(RelevancyDistance);
+
+	TArray<FImpactEvent> RelevantEvents;
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController == nullptr || PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(PlayerController->GetPawn());
+		if (Character == nullptr)
+		{
+			continue;
+		}
+
+		const AMultiShootGamePlayerState* PlayerState = PlayerController->GetPlayerState<
+			AMultiShootGamePlayerState>();
+		const int MatchInstanceId = PlayerState ? PlayerState->GetMatchInstanceId() : INDEX_NONE;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		RelevantEvents.Reset();
+		for (const FRecordedImpact& RecordedImpact : RecordedImpacts)
+		{
+			if (MatchInstanceId != INDEX_NONE && RecordedImpact.MatchInstanceId != INDEX_NONE &&
+				MatchInstanceId != RecordedImpact.MatchInstanceId)
+			{
+				continue;
+			}
+
+			if (FVector::DistSquared(ViewLocation, RecordedImpact.ImpactEvent.Location) > RelevancyDistanceSquared)
+			{
+				continue;
+			}
+
+			RelevantEvents.Add(RecordedImpact.ImpactEvent);
+			if (RelevantEvents.Num() >= MaxEventsPerMessage)
+			{
+				break;
+			}
+		}
+
+		if (RelevantEvents.Num() > 0)
+		{
+			Character->ImpactEvents_Client(RelevantEvents);
+
+			INC_DWORD_STAT_BY(STAT_ImpactEventsSent, RelevantEvents.Num());
+			INC_DWORD_STAT(STAT_ImpactEventMessages);
+		}
+	}
+}
+
+void UImpactEventSubsystem::PlayImpactEvent(const FImpactEvent& ImpactEvent) const
+{
+	const IMultiShootGameImpactSource* ImpactSource = ImpactEvent.SourceClass
+		                                                  ? Cast<IMultiShootGameImpactSource>(
+			                                                  ImpactEvent.SourceClass->GetDefaultObject())
+		                                                  : nullptr;
+	if (ImpactSource == nullptr)
+	{
+		return;
+	}
+
+	const UHitEffectComponent* HitEffectComponent = ImpactSource->GetImpactHitEffect();
+	if (HitEffectComponent)
+	{
+		UHitEffectComponent::PlayImpactEffect(this, HitEffectComponent->SelectImpactEffect(ImpactEvent.SurfaceType),
+		                                      ImpactEvent.Location, ImpactEvent.Direction.Rotation());
+	}
+
+	if (ImpactEvent.bSpawnDecal)
+	{
+		UDecalManagerSubsystem::SpawnDecal(this, ImpactSource->GetImpactDecalMaterial(),
+		                                   ImpactSource->GetImpactDecalSize(), ImpactEvent.Location,
+		                                   ImpactEvent.Normal.Rotation());
+	}
+}
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MultiShootGame/Struct/ImpactEvent.h"
+#include "ImpactEventSubsystem.generated.h"
+
+/**
+ * Cosmetic impact stream. The server records bullet impacts into a per-frame batch and sends every client one
+ * unreliable message with the impacts relevant to it; effects and decals are only ever spawned where they render.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UImpactEventSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	float RelevancyDistance = 10000.f;
+
+	UPROPERTY(Config)
+	int MaxEventsPerMessage = 64;
+
+	struct FRecordedImpact
+	{
+		FImpactEvent ImpactEvent;
+
+		int MatchInstanceId = INDEX_NONE;
+	};
+
+	TArray<FRecordedImpact> RecordedImpacts;
+
+	FDelegateHandle PostActorTickHandle;
+
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	void SendImpactEvents();
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	void AddImpact(const AActor* Source, FVector Location, FVector Normal, FVector Direction,
+	               EPhysicalSurface SurfaceType, bool bSpawnDecal);
+
+	/** Plays an impact locally, on clients and on listen or standalone servers. */
+	void PlayImpactEvent(const FImpactEvent& ImpactEvent) const;
+
+	static void RecordImpact(const AActor* Source, FVector Location, FVector Normal, FVector Direction,
+	                         EPhysicalSurface SurfaceType, bool bSpawnDecal);
+};
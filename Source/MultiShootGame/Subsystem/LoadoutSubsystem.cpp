@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "LoadoutSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Kismet/GameplayStatics.h"
+#include "MultiShootGame/SaveGame/ChooseWeaponSaveGame.h"
+
+static void CacheSelectedWeaponInfo(TMap<EWeaponMode, FWeaponInfo>& SelectedWeaponInfos, EWeaponMode WeaponMode,
+                                    const TArray<FWeaponInfo>& WeaponInfoList, int WeaponIndex)
+{
+	if (WeaponInfoList.IsValidIndex(WeaponIndex))
+	{
+		SelectedWeaponInfos.Add(WeaponMode, WeaponInfoList[WeaponIndex]);
+	}
+}
+
+bool ULoadoutSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Only locally controlled characters read the loadout
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void ULoadoutSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &ULoadoutSubsystem::OnPreLoadMap);
+
+	StartLoad();
+}
+
+void ULoadoutSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	OnLoadoutLoaded.Clear();
+
+	Super::Deinitialize();
+}
+
+void ULoadoutSubsystem::StartLoad()
+{
+	bLoadoutLoaded = false;
+
+	const uint32 Serial = ++LoadSerial;
+	const FAsyncLoadGameFromSlotDelegate LoadedDelegate = FAsyncLoadGameFromSlotDelegate::CreateWeakLambda(
+		this, [this, Serial](const FString&, const int32, USaveGame* LoadedSaveGame)
+		{
+			OnSaveGameLoaded(Serial, LoadedSaveGame);
+		});
+
+	UGameplayStatics::AsyncLoadGameFromSlot(SlotName, UserIndex, LoadedDelegate);
+}
+
+void ULoadoutSubsystem::OnSaveGameLoaded(uint32 Serial, USaveGame* LoadedSaveGame)
+{
+	if (Serial != LoadSerial)
+	{
+		return;
+	}
+
+	CacheLoadout(Cast<UChooseWeaponSaveGame>(LoadedSaveGame));
+}
+
+void ULoadoutSubsystem::CacheLoadout(const UChooseWeaponSaveGame* SaveGame)
+{
+	// Only the picked entry of each list is kept, the lists themselves go away with the save object
+	SelectedWeaponInfos.Reset();
+
+	if (SaveGame)
+	{
+		CacheSelectedWeaponInfo(SelectedWeaponInfos, EWeaponMode::MainWeapon, SaveGame->MainWeaponList,
+		                        SaveGame->MainWeaponIndex);
+		CacheSelectedWeaponInfo(SelectedWeaponInfos, EWeaponMode::SecondWeapon, SaveGame->SecondWeaponList,
+		                        SaveGame->SecondWeaponIndex);
+		CacheSelectedWeaponInfo(SelectedWeaponInfos, EWeaponMode::ThirdWeapon, SaveGame->ThirdWeaponList,
+		                        SaveGame->ThirdWeaponIndex);
+	}
+
+	bLoadoutLoaded = true;
+
+	OnLoadoutLoaded.Broadcast();
+}
+
+void ULoadoutSubsystem::OnPreLoadMap(const FString& MapName)
+{
+	// The menu may have saved a new pick before travelling, weapons in the next map wait for the fresh read
+	StartLoad();
+}
+
+const FWeaponInfo* ULoadoutSubsystem::GetSelectedWeaponInfo(EWeaponMode WeaponMode) const
+{
+	return SelectedWeaponInfos.Find(WeaponMode);
+}
+
+void ULoadoutSubsystem::SetLoadout(UChooseWeaponSaveGame* SaveGame)
+{
+	++LoadSerial;
+
+	CacheLoadout(SaveGame);
+}
+
+ULoadoutSubsystem* ULoadoutSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+
+	return GameInstance ? GameInstance->GetSubsystem<ULoadoutSubsystem>() : nullptr;
+}
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "MultiShootGame/Enum/EWeaponMode.h"
+#include "MultiShootGame/Struct/WeaponInfo.h"
+#include "LoadoutSubsystem.generated.h"
+
+class UChooseWeaponSaveGame;
+class USaveGame;
+
+DECLARE_MULTICAST_DELEGATE(FOnLoadoutLoadedSignature);
+
+/**
+ * Keeps the weapons picked in the choose weapon menu for the whole session. The save slot is read asynchronously
+ * once at startup and again before each map load, so spawning and respawning weapons never touches the disk.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API ULoadoutSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	FString SlotName = TEXT("ChooseWeapon");
+
+	UPROPERTY(Config)
+	int UserIndex = 0;
+
+	TMap<EWeaponMode, FWeaponInfo> SelectedWeaponInfos;
+
+	bool bLoadoutLoaded = false;
+
+	/** Bumped by every load and SetLoadout, so a slower stale load can't overwrite a newer loadout. */
+	uint32 LoadSerial = 0;
+
+	FDelegateHandle PreLoadMapHandle;
+
+	void StartLoad();
+
+	void OnSaveGameLoaded(uint32 Serial, USaveGame* LoadedSaveGame);
+
+	void CacheLoadout(const UChooseWeaponSaveGame* SaveGame);
+
+	void OnPreLoadMap(const FString& MapName);
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	/** Fired once the save has been read, including when there is no save and the weapons keep their defaults. */
+	FOnLoadoutLoadedSignature OnLoadoutLoaded;
+
+	/** Null when the save has no valid pick for the mode. */
+	const FWeaponInfo* GetSelectedWeaponInfo(EWeaponMode WeaponMode) const;
+
+	/** Lets the menu push a loadout it just saved, instead of waiting for the next map load to read it back. */
+	UFUNCTION(BlueprintCallable, Category = Loadout)
+	void SetLoadout(UChooseWeaponSaveGame* SaveGame);
+
+	FORCEINLINE bool IsLoadoutLoaded() const { return bLoadoutLoaded; }
+
+	static ULoadoutSubsystem* Get(const UObject* WorldContextObject);
+};
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "MultiShootGameTickableWorldSubsystem.h"
+
+void UMultiShootGameTickableWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	bInitialized = true;
+}
+
+void UMultiShootGameTickableWorldSubsystem::Deinitialize()
+{
+	bInitialized = false;
+
+	Super::Deinitialize();
+}
+
+ETickableTickType UMultiShootGameTickableWorldSubsystem::GetTickableTickType() const
+{
+	// The class default object exists for every subsystem class but must never tick
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UMultiShootGameTickableWorldSubsystem::IsTickable() const
+{
+	return bInitialized;
+}
+
+UWorld* UMultiShootGameTickableWorldSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "MultiShootGameTickableWorldSubsystem.generated.h"
+
+/**
+ * World subsystem that ticks once per frame with the world, between Initialize and Deinitialize. UE 4.27 has no
+ * UTickableWorldSubsystem, so this is the base for every per-frame subsystem in the module.
+ */
+UCLASS(Abstract)
+class MULTISHOOTGAME_API UMultiShootGameTickableWorldSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+protected:
+	bool bInitialized = false;
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	virtual ETickableTickType GetTickableTickType() const override;
+
+	virtual bool IsTickable() const override;
+
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+
+	virtual void Tick(float DeltaTime) override PURE_VIRTUAL(UMultiShootGameTickableWorldSubsystem::Tick, );
+
+	virtual TStatId GetStatId() const override PURE_VIRTUAL(UMultiShootGameTickableWorldSubsystem::GetStatId,
+	                                                         return TStatId(););
+};
@@ -0,0 +1,302 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PathCacheSubsystem.h"
+#include "NavigationSystem.h"
+#include "MultiShootGame/MultiShootGame.h"
+
+DECLARE_CYCLE_STAT(TEXT("Path Cache Tick"), STAT_PathCacheTick, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Path Cache Hits"), STAT_PathCacheHits, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Path Cache Misses"), STAT_PathCacheMisses, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Path Cache Pending Queries"), STAT_PathCachePendingQueries,
+                               STATGROUP_MultiShootGame);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Path Cache Hit Rate"), STAT_PathCacheHitRate, STATGROUP_MultiShootGame);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Path Cache Time Saved (ms)"), STAT_PathCacheTimeSaved, STATGROUP_MultiShootGame);
+
+bool UPathCacheSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPathCacheSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld);
+	if (NavigationSystem)
+	{
+		NavigationSystem->OnNavigationGenerationFinishedDelegate.AddDynamic(
+			this, &UPathCacheSubsystem::OnNavigationGenerationFinished);
+	}
+}
+
+void UPathCacheSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PathCacheTick);
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	for (auto It = CachedPaths.CreateIterator(); It; ++It)
+	{
+		if (CurrentTime - It.Value().CreatedTime > MaxPathAge)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = FailedPaths.CreateIterator(); It; ++It)
+	{
+		if (CurrentTime - It.Value() > FailedPathAge)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = Results.CreateIterator(); It; ++It)
+	{
+		if (CurrentTime - It.Value().CompletedTime > ResultTimeout)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	UNavigationSystemV1* NavigationSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const ANavigationData* NavData = NavigationSystem ? NavigationSystem->GetDefaultNavDataInstance() : nullptr;
+
+	const int NumQueries = FMath::Min(PendingQueries.Num(), MaxQueriesPerFrame);
+	for (int i = 0; i < NumQueries; i++)
+	{
+		const FPendingQuery& PendingQuery = PendingQueries[i];
+
+		FPathResult Result;
+		Result.CompletedTime = CurrentTime;
+
+		// An earlier query this frame may already have produced a path or a failure this one can reuse
+		if (FindCachedPath(PendingQuery.Key, PendingQuery.Start, Result.PathPoints))
+		{
+			Result.bSuccess = true;
+		}
+		else if (FailedPaths.Contains(PendingQuery.Key))
+		{
+			NumHits++;
+			TimeSaved += AverageQueryTime;
+			INC_DWORD_STAT(STAT_PathCacheHits);
+		}
+		else if (NavData)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+
+			if (SplicePath(PendingQuery.Key, PendingQuery.Start, Result.PathPoints))
+			{
+				Result.bSuccess = true;
+
+				// The splice raycasts are what skipping the path query cost
+				NumHits++;
+				NumSpliceHits++;
+				TimeSaved += AverageQueryTime - (FPlatformTime::Seconds() - StartTime);
+				INC_DWORD_STAT(STAT_PathCacheHits);
+			}
+			else
+			{
+				const FPathFindingQuery Query(this, *NavData, PendingQuery.Start, PendingQuery.Goal,
+				                              NavData->GetDefaultQueryFilter());
+				const FPathFindingResult PathResult = NavigationSystem->FindPathSync(Query);
+
+				// A splice attempt that found nothing is part of the cost of the miss
+				AverageQueryTime = FMath::Lerp(AverageQueryTime, FPlatformTime::Seconds() - StartTime, 0.1);
+				NumMisses++;
+				INC_DWORD_STAT(STAT_PathCacheMisses);
+
+				if (PathResult.IsSuccessful() && PathResult.Path.IsValid())
+				{
+					for (const FNavPathPoint& PathPoint : PathResult.Path->GetPathPoints())
+					{
+						Result.PathPoints.Add(PathPoint.Location);
+					}
+
+					Result.bSuccess = true;
+
+					FCachedPath& CachedPath = CachedPaths.Add(PendingQuery.Key);
+					CachedPath.PathPoints = Result.PathPoints;
+					CachedPath.CreatedTime = CurrentTime;
+				}
+				else
+				{
+					FailedPaths.Add(PendingQuery.Key, CurrentTime);
+				}
+			}
+		}
+
+		for (const int RequestId : PendingQuery.RequestIds)
+		{
+			Results.Add(RequestId, Result);
+		}
+	}
+
+	PendingQueries.RemoveAt(0, NumQueries, false);
+
+	SET_DWORD_STAT(STAT_PathCachePendingQueries, PendingQueries.Num());
+	SET_FLOAT_STAT(STAT_PathCacheHitRate, GetHitRate());
+	SET_FLOAT_STAT(STAT_PathCacheTimeSaved, GetTimeSavedMs());
+}
+
+TStatId UPathCacheSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_PathCacheTick);
+}
+
+FIntVector UPathCacheSubsystem::Quantize(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt(Location.X / QuantizeSize), FMath::FloorToInt(Location.Y / QuantizeSize),
+	                  FMath::FloorToInt(Location.Z / QuantizeSize));
+}
+
+bool UPathCacheSubsystem::FindCachedPath(const FPathCacheKey& Key, const FVector& Start,
+                                         TArray<FVector>& OutPathPoints)
+{
+	const FCachedPath* CachedPath = CachedPaths.Find(Key);
+	if (CachedPath == nullptr)
+	{
+		return false;
+	}
+
+	// The cached path begins where the first bot in this cell stood, so this bot walks there first
+	OutPathPoints.Reset(CachedPath->PathPoints.Num() + 1);
+	OutPathPoints.Add(Start);
+	OutPathPoints.Append(CachedPath->PathPoints);
+
+	NumHits++;
+	TimeSaved += AverageQueryTime;
+	INC_DWORD_STAT(STAT_PathCacheHits);
+
+	return true;
+}
+
+bool UPathCacheSubsystem::SplicePath(const FPathCacheKey& Key, const FVector& Start,
+                                     TArray<FVector>& OutPathPoints) const
+{
+	int NumCandidates = 0;
+	int NumRaycasts = 0;
+
+	// Join a path to the same goal at the first point we can reach in a straight line
+	for (const TPair<FPathCacheKey, FCachedPath>& Pair : CachedPaths)
+	{
+		if (Pair.Key.GoalCell != Key.GoalCell)
+		{
+			continue;
+		}
+
+		if (NumCandidates >= MaxSpliceCandidates)
+		{
+			return false;
+		}
+		NumCandidates++;
+
+		const TArray<FVector>& PathPoints = Pair.Value.PathPoints;
+		for (int i = 0; i < PathPoints.Num(); i++)
+		{
+			if (FVector::DistSquared(Start, PathPoints[i]) > FMath::Square(SpliceDistance))
+			{
+				continue;
+			}
+
+			if (NumRaycasts >= MaxSpliceRaycasts)
+			{
+				return false;
+			}
+			NumRaycasts++;
+
+			FVector HitLocation;
+			if (UNavigationSystemV1::NavigationRaycast(GetWorld(), Start, PathPoints[i], HitLocation))
+			{
+				continue;
+			}
+
+			OutPathPoints.Reset(PathPoints.Num() - i + 1);
+			OutPathPoints.Add(Start);
+			OutPathPoints.Append(&PathPoints[i], PathPoints.Num() - i);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UPathCacheSubsystem::RequestPath(const FVector& Start, const FVector& Goal, TArray<FVector>& OutPathPoints,
+                                      int& OutRequestId)
+{
+	const FPathCacheKey Key{Quantize(Start), Quantize(Goal)};
+
+	OutRequestId = INDEX_NONE;
+	if (FindCachedPath(Key, Start, OutPathPoints))
+	{
+		return true;
+	}
+
+	OutRequestId = NextRequestId++;
+
+	// A query that just failed would fail again, so it is answered on the next poll without searching
+	if (FailedPaths.Contains(Key))
+	{
+		FPathResult& Result = Results.Add(OutRequestId);
+		Result.CompletedTime = GetWorld()->GetTimeSeconds();
+
+		NumHits++;
+		TimeSaved += AverageQueryTime;
+		INC_DWORD_STAT(STAT_PathCacheHits);
+
+		return false;
+	}
+
+	// Bots in the same start cell chasing the same goal share one queued query
+	FPendingQuery* PendingQuery = PendingQueries.FindByPredicate([&Key](const FPendingQuery& TempQuery)
+	{
+		return TempQuery.Key == Key;
+	});
+
+	if (PendingQuery == nullptr)
+	{
+		PendingQuery = &PendingQueries.AddDefaulted_GetRef();
+		PendingQuery->Key = Key;
+		PendingQuery->Start = Start;
+		PendingQuery->Goal = Goal;
+	}
+
+	PendingQuery->RequestIds.Add(OutRequestId);
+
+	return false;
+}
+
+bool UPathCacheSubsystem::ConsumeResult(int RequestId, TArray<FVector>& OutPathPoints, bool& bOutSuccess)
+{
+	FPathResult Result;
+	if (!Results.RemoveAndCopyValue(RequestId, Result))
+	{
+		return false;
+	}
+
+	OutPathPoints = MoveTemp(Result.PathPoints);
+	bOutSuccess = Result.bSuccess;
+
+	return true;
+}
+
+void UPathCacheSubsystem::Invalidate()
+{
+	CachedPaths.Reset();
+	FailedPaths.Reset();
+}
+
+float UPathCacheSubsystem::GetHitRate() const
+{
+	const int NumRequests = NumHits + NumMisses;
+
+	return NumRequests > 0 ? static_cast<float>(NumHits) / NumRequests : 0.f;
+}
+
+void UPathCacheSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+	UE_LOG(LogMultiShootGame, Verbose, TEXT("Path cache: navigation rebuilt, dropping %d paths"), CachedPaths.Num());
+
+	Invalidate();
+}
@@ -0,0 +1,146 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MultiShootGameTickableWorldSubsystem.h"
+#include "PathCacheSubsystem.generated.h"
+
+class ANavigationData;
+
+/**
+ * Shared navmesh path cache for bots. Paths are keyed by quantized start and goal cells and reused across bots
+ * chasing the same target. Queries that miss the cache are spread across frames, where they first try to splice
+ * onto a cached path to the same goal before running a full path query.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UPathCacheSubsystem : public UMultiShootGameTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	float QuantizeSize = 300.f;
+
+	UPROPERTY(Config)
+	float MaxPathAge = 2.f;
+
+	UPROPERTY(Config)
+	float SpliceDistance = 400.f;
+
+	UPROPERTY(Config)
+	int MaxQueriesPerFrame = 4;
+
+	UPROPERTY(Config)
+	float ResultTimeout = 5.f;
+
+	/** Cached paths to the same goal a queued query tries to splice onto before a full path query. */
+	UPROPERTY(Config)
+	int MaxSpliceCandidates = 4;
+
+	/** Navmesh raycasts one splice attempt may spend across all of its candidates. */
+	UPROPERTY(Config)
+	int MaxSpliceRaycasts = 8;
+
+	/** How long a failed query answers the same start and goal cells without searching again. */
+	UPROPERTY(Config)
+	float FailedPathAge = 1.f;
+
+	struct FPathCacheKey
+	{
+		FIntVector StartCell;
+
+		FIntVector GoalCell;
+
+		bool operator==(const FPathCacheKey& Other) const
+		{
+			return StartCell == Other.StartCell && GoalCell == Other.GoalCell;
+		}
+
+		friend uint32 GetTypeHash(const FPathCacheKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.StartCell), GetTypeHash(Key.GoalCell));
+		}
+	};
+
+	struct FCachedPath
+	{
+		TArray<FVector> PathPoints;
+
+		double CreatedTime = 0.0;
+	};
+
+	struct FPendingQuery
+	{
+		FPathCacheKey Key;
+
+		FVector Start;
+
+		FVector Goal;
+
+		TArray<int> RequestIds;
+	};
+
+	struct FPathResult
+	{
+		TArray<FVector> PathPoints;
+
+		bool bSuccess = false;
+
+		double CompletedTime = 0.0;
+	};
+
+	TMap<FPathCacheKey, FCachedPath> CachedPaths;
+
+	/** Time each recently failed query completed at. */
+	TMap<FPathCacheKey, double> FailedPaths;
+
+	TArray<FPendingQuery> PendingQueries;
+
+	TMap<int, FPathResult> Results;
+
+	int NextRequestId = 0;
+
+	int NumHits = 0;
+
+	int NumSpliceHits = 0;
+
+	int NumMisses = 0;
+
+	double AverageQueryTime = 0.0;
+
+	double TimeSaved = 0.0;
+
+	FIntVector Quantize(const FVector& Location) const;
+
+	bool FindCachedPath(const FPathCacheKey& Key, const FVector& Start, TArray<FVector>& OutPathPoints);
+
+	bool SplicePath(const FPathCacheKey& Key, const FVector& Start, TArray<FVector>& OutPathPoints) const;
+
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData* NavData);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Returns true with the path points when the cache can answer straight away. Otherwise the query is queued and
+	 * OutRequestId can be polled with ConsumeResult on later frames.
+	 */
+	bool RequestPath(const FVector& Start, const FVector& Goal, TArray<FVector>& OutPathPoints, int& OutRequestId);
+
+	/** Returns true once the queued request has completed. bOutSuccess is false when no path was found. */
+	bool ConsumeResult(int RequestId, TArray<FVector>& OutPathPoints, bool& bOutSuccess);
+
+	void Invalidate();
+
+	float GetHitRate() const;
+
+	FORCEINLINE double GetTimeSavedMs() const { return TimeSaved * 1000.0; }
+};
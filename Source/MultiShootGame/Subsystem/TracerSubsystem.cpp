@@ -0,0 +1,143 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "TracerSubsystem.h"
+#include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/ParticleSystem/ParticleSystemPool.h"
+#include "Particles/ParticleSystemComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Tracers Flush"), STAT_TracersFlush, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tracers Played"), STAT_TracersPlayed, STATGROUP_MultiShootGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tracers Dropped"), STAT_TracersDropped, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tracers Active"), STAT_TracersActive, STATGROUP_MultiShootGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tracers Pooled"), STAT_TracersPooled, STATGROUP_MultiShootGame);
+
+bool UTracerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTracerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+		this, &UTracerSubsystem::OnWorldPostActorTick);
+}
+
+void UTracerSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	QueuedTracers.Empty();
+
+	for (const TPair<UParticleSystem*, UParticleSystemPool*>& Pair : Pools)
+	{
+		Pair.Value->ReleaseAll();
+	}
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+UParticleSystemPool* UTracerSubsystem::FindOrCreatePool(UParticleSystem* Template)
+{
+	if (Template == nullptr || GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return nullptr;
+	}
+
+	UParticleSystemPool** ExistingPool = Pools.Find(Template);
+	if (ExistingPool)
+	{
+		return *ExistingPool;
+	}
+
+	UParticleSystemPool* Pool = NewObject<UParticleSystemPool>(this);
+	Pool->InitializePool(Template, MaxActivePerTracer, PrewarmPerTracer);
+
+	Pools.Add(Template, Pool);
+
+	return Pool;
+}
+
+void UTracerSubsystem::AddTracer(UParticleSystem* Template, FVector Start, FVector End, FName TargetParameterName)
+{
+	if (Template == nullptr || GetWorld()->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// Past the per-frame cap the extra tracers would only steal emitters from the ones just started
+	if (QueuedTracers.Num() >= MaxTracersPerFrame)
+	{
+		INC_DWORD_STAT(STAT_TracersDropped);
+		return;
+	}
+
+	FQueuedTracer& QueuedTracer = QueuedTracers.AddDefaulted_GetRef();
+	QueuedTracer.Template = Template;
+	QueuedTracer.Start = Start;
+	QueuedTracer.End = End;
+	QueuedTracer.TargetParameterName = TargetParameterName;
+}
+
+void UTracerSubsystem::PrewarmTracer(UParticleSystem* Template)
+{
+	FindOrCreatePool(Template);
+}
+
+void UTracerSubsystem::SpawnTracer(const UObject* WorldContextObject, UParticleSystem* Template, FVector Start,
+                                   FVector End, FName TargetParameterName)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UTracerSubsystem* TracerSubsystem = World ? World->GetSubsystem<UTracerSubsystem>() : nullptr;
+
+	if (TracerSubsystem)
+	{
+		TracerSubsystem->AddTracer(Template, Start, End, TargetParameterName);
+	}
+}
+
+void UTracerSubsystem::OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld() || QueuedTracers.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_TracersFlush);
+
+	for (const FQueuedTracer& QueuedTracer : QueuedTracers)
+	{
+		UParticleSystemPool* Pool = FindOrCreatePool(QueuedTracer.Template);
+		if (Pool == nullptr)
+		{
+			continue;
+		}
+
+		UParticleSystemComponent* TracerComponent = Pool->Play(QueuedTracer.Start,
+		                                                       (QueuedTracer.End - QueuedTracer.Start).Rotation());
+		if (TracerComponent)
+		{
+			TracerComponent->SetVectorParameter(QueuedTracer.TargetParameterName, QueuedTracer.End);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_TracersPlayed, QueuedTracers.Num());
+	QueuedTracers.Reset();
+
+	UpdateStats();
+}
+
+void UTracerSubsystem::UpdateStats() const
+{
+	int NumActive = 0;
+	int NumPooled = 0;
+	for (const TPair<UParticleSystem*, UParticleSystemPool*>& Pair : Pools)
+	{
+		NumActive += Pair.Value->GetNumActive();
+		NumPooled += Pair.Value->GetNumFree();
+	}
+
+	SET_DWORD_STAT(STAT_TracersActive, NumActive);
+	SET_DWORD_STAT(STAT_TracersPooled, NumPooled);
+}
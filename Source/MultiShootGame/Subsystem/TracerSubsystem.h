@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TracerSubsystem.generated.h"
+
+class UParticleSystem;
+class UParticleSystemPool;
+
+/**
+ * Draws bullet tracers from fixed per-template emitter pools. Weapons queue (start, end) pairs during the frame and
+ * the whole list is played after all actors have ticked, so any number of firing bots costs a constant number of
+ * components.
+ */
+UCLASS(config = Game)
+class MULTISHOOTGAME_API UTracerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(Config)
+	int MaxActivePerTracer = 32;
+
+	UPROPERTY(Config)
+	int PrewarmPerTracer = 8;
+
+	UPROPERTY(Config)
+	int MaxTracersPerFrame = 64;
+
+	struct FQueuedTracer
+	{
+		UParticleSystem* Template = nullptr;
+
+		FVector Start = FVector::ZeroVector;
+
+		FVector End = FVector::ZeroVector;
+
+		FName TargetParameterName;
+	};
+
+	TArray<FQueuedTracer> QueuedTracers;
+
+	UPROPERTY()
+	TMap<UParticleSystem*, UParticleSystemPool*> Pools;
+
+	FDelegateHandle PostActorTickHandle;
+
+	UParticleSystemPool* FindOrCreatePool(UParticleSystem* Template);
+
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	void UpdateStats() const;
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	void AddTracer(UParticleSystem* Template, FVector Start, FVector End, FName TargetParameterName);
+
+	/** Creates the pool up front so the first shots of a match don't allocate components. */
+	void PrewarmTracer(UParticleSystem* Template);
+
+	static void SpawnTracer(const UObject* WorldContextObject, UParticleSystem* Template, FVector Start, FVector End,
+	                        FName TargetParameterName);
+};
@@ -2,12 +2,14 @@
 
 
 #include "MultiSHootGameEnemyWeapon.h"
-#include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Engine/Public/TimerManager.h"
 #include "MultiShootGame/MultiShootGame.h"
+#include "MultiShootGame/Component/HealthComponent.h"
+#include "MultiShootGame/GameMode/MultiShootGameMatchInstance.h"
+#include "MultiShootGame/Subsystem/TracerSubsystem.h"
 
 // Sets default values
 AMultiShootGameEnemyWeapon::AMultiShootGameEnemyWeapon()
@@ -18,9 +20,11 @@ AMultiShootGameEnemyWeapon::AMultiShootGameEnemyWeapon()
 	WeaponMeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("WeaponMeshComponent"));
 	RootComponent = WeaponMeshComponent;
 
-	AudioComponent = CreateDefaultSubobject<UAudioComponent>(TEXT("AudioComponent"));
-	AudioComponent->SetupAttachment(RootComponent);
-	AudioComponent->SetAutoActivate(false);
+	AudioComponent = CreateDefaultSubobject<UWeaponAudioComponent>(TEXT("AudioComponent"));
+	AudioComponent->SetupAttachment(RootComponent, MuzzleSocketName);
+
+	MuzzleFlashComponent = CreateDefaultSubobject<UMuzzleFlashComponent>(TEXT("MuzzleFlashComponent"));
+	MuzzleFlashComponent->SetupAttachment(RootComponent, MuzzleSocketName);
 }
 
 // Called when the game starts or when spawned
@@ -28,7 +32,24 @@ void AMultiShootGameEnemyWeapon::BeginPlay()
 {
 	Super::BeginPlay();
 
+	MuzzleFlashComponent->AttachToComponent(WeaponMeshComponent,
+	                                        FAttachmentTransformRules::SnapToTargetNotIncludingScale, MuzzleSocketName);
+	AudioComponent->AttachToComponent(WeaponMeshComponent, FAttachmentTransformRules::SnapToTargetNotIncludingScale,
+	                                  MuzzleSocketName);
+
+	// Older blueprints set the shot sound on the audio component itself, which now only holds the fire loop
+	if (FireSound == nullptr)
+	{
+		FireSound = AudioComponent->Sound;
+	}
+
 	TimeBetweenShots = 60.0f / RateOfFire;
+
+	UTracerSubsystem* TracerSubsystem = GetWorld()->GetSubsystem<UTracerSubsystem>();
+	if (TracerSubsystem)
+	{
+		TracerSubsystem->PrewarmTracer(TracerEffect);
+	}
 }
 
 void AMultiShootGameEnemyWeapon::Fire()
@@ -50,28 +71,23 @@ void AMultiShootGameEnemyWeapon::Fire()
 		FCollisionQueryParams QueryOParams;
 		QueryOParams.AddIgnoredActor(MyOwner);
 		QueryOParams.AddIgnoredActor(this);
-		QueryOParams.bTraceComplex = true;
-		QueryOParams.bReturnPhysicalMaterial = true;
+		QueryOParams.bTraceComplex = false;
+		QueryOParams.bReturnPhysicalMaterial = false;
+		AMultiShootGameMatchInstance::IgnoreOtherMatches(MyOwner, QueryOParams);
 
 		FVector TraceEndPoint = TraceEnd;
 
-		EPhysicalSurface SurfaceType = SurfaceType_Default;
-		TArray<AActor*> IgnoreActors;
-		IgnoreActors.Add(GetOwner());
+		// Head hits come from the hit zone table, so the trace doesn't need to return physical materials
 		FHitResult HitResult;
-		if (UKismetSystemLibrary::LineTraceSingle(GetWorld(), EyeLocation, TraceEnd,TraceType_EnemyWeaponTrace, false,
-		                                          IgnoreActors, EDrawDebugTrace::None, HitResult, true))
+		if (GetWorld()->LineTraceSingleByChannel(HitResult, EyeLocation, TraceEnd,
+		                                         UEngineTypes::ConvertToCollisionChannel(TraceType_EnemyWeaponTrace),
+		                                         QueryOParams))
 		{
 			AActor* HitActor = HitResult.GetActor();
 
-			SurfaceType = UPhysicalMaterial::DetermineSurfaceType(HitResult.PhysMaterial.Get());
-
-			float CurrentDamage = BaseDamage;
-
-			if (SurfaceType == SURFACE_HEAD)
-			{
-				CurrentDamage *= 2.5f;
-			}
+			bool bHeadShot = false;
+			const float CurrentDamage = BaseDamage * UHealthComponent::GetHitZoneMultiplier(
+				HitActor, HitResult.GetComponent(), HitResult.Item, bHeadShot);
 
 			UGameplayStatics::ApplyPointDamage(HitActor, CurrentDamage, ShotDirection, HitResult,
 			                                   MyOwner->GetInstigatorController(),
@@ -84,27 +100,19 @@ void AMultiShootGameEnemyWeapon::Fire()
 
 		LastFireTime = GetWorld()->TimeSeconds;
 
-		AudioComponent->Play();
+		AudioComponent->PlayFireSound(FireSound, FireLoopSound, FireTailSound, FireSoundConcurrency);
 	}
 }
 
 void AMultiShootGameEnemyWeapon::PlayFireEffect(FVector TraceEndPoint)
 {
-	if (MuzzleEffect)
-	{
-		UGameplayStatics::SpawnEmitterAttached(MuzzleEffect, WeaponMeshComponent, MuzzleSocketName);
-	}
+	MuzzleFlashComponent->PlayMuzzleFlash(MuzzleEffect, MuzzleBurstEffect);
 
 	if (TracerEffect)
 	{
 		const FVector MuzzleLocation = WeaponMeshComponent->GetSocketLocation(MuzzleSocketName);
 
-		UParticleSystemComponent* TracerComponent = UGameplayStatics::SpawnEmitterAtLocation(
-			GetWorld(), TracerEffect, MuzzleLocation);
-		if (TracerComponent)
-		{
-			TracerComponent->SetVectorParameter(TracerTargetName, TraceEndPoint);
-		}
+		UTracerSubsystem::SpawnTracer(this, TracerEffect, MuzzleLocation, TraceEndPoint, TracerTargetName);
 	}
 }
 
@@ -124,6 +132,9 @@ void AMultiShootGameEnemyWeapon::StartFire()
 void AMultiShootGameEnemyWeapon::StopFire()
 {
 	GetWorldTimerManager().ClearTimer(TimerHandle);
+
+	MuzzleFlashComponent->StopMuzzleFlash();
+	AudioComponent->StopFireSound();
 }
 
 void AMultiShootGameEnemyWeapon::EnablePhysicsSimulate()
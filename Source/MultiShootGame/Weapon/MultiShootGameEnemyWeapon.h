@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "MultiShootGame/Component/MuzzleFlashComponent.h"
+#include "MultiShootGame/Component/WeaponAudioComponent.h"
 #include "MultiShootGameEnemyWeapon.generated.h"
 
 UCLASS()
@@ -29,7 +31,10 @@ protected:
 	USkeletalMeshComponent* WeaponMeshComponent;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components)
-	UAudioComponent* AudioComponent;
+	UWeaponAudioComponent* AudioComponent;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components)
+	UMuzzleFlashComponent* MuzzleFlashComponent;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
 	TSubclassOf<UDamageType> DamageType;
@@ -49,9 +54,24 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
 	UParticleSystem* MuzzleEffect;
 
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
+	UParticleSystem* MuzzleBurstEffect;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
 	UParticleSystem* TracerEffect;
 
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
+	USoundBase* FireSound;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
+	USoundBase* FireLoopSound;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
+	USoundBase* FireTailSound;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
+	USoundConcurrency* FireSoundConcurrency;
+
 	FTimerHandle TimerHandle;
 
 	FTimerHandle DestroyTimerHandle;
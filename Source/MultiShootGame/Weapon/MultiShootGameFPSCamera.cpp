@@ -3,7 +3,6 @@
 #include "MultiShootGameFPSCamera.h"
 
 #include "Blueprint/UserWidget.h"
-#include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "MultiShootGame/Character/MultiShootGameCharacter.h"
@@ -20,6 +19,11 @@ AMultiShootGameFPSCamera::AMultiShootGameFPSCamera()
 	ArmsMeshComponent->SetIsReplicated(true);
 
 	WeaponMeshComponent->SetupAttachment(ArmsMeshComponent, WeaponSocketName);
+
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	// The character hands over the current weapon's info once the loadout is ready
+	bUseSavedLoadout = false;
 }
 
 void AMultiShootGameFPSCamera::BeginPlay()
@@ -27,7 +31,15 @@ void AMultiShootGameFPSCamera::BeginPlay()
 	Super::BeginPlay();
 
 	DefaultFOV = CameraComponent->FieldOfView;
-	bInitializeReady = true;
+
+	AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(GetOwner());
+	if (Character)
+	{
+		// The character pushes the view state during its own tick, so it has to tick first
+		AddTickPrerequisiteActor(Character);
+
+		Character->TryInitializeLoadout();
+	}
 
 	CurrentSniperUserWidget = CreateWidget(GetWorld(), SniperUserWidgetClass);
 	CurrentSniperUserWidget->AddToViewport();
@@ -38,19 +50,48 @@ void AMultiShootGameFPSCamera::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(GetOwner());
-	if (Character)
+	const float TargetFOV = GetTargetFOV();
+	float CurrentFOV = FMath::FInterpTo(CameraComponent->FieldOfView, TargetFOV, DeltaTime, ZoomInterpSpeed);
+	if (FMath::IsNearlyEqual(CurrentFOV, TargetFOV, 0.01f))
 	{
-		Speed = Character->GetCharacterMovement()->Velocity.Size();
-		bFired = Character->GetFired();
-		bAimed = Character->GetAimed();
-		bReloading = Character->GetReloading();
-		bToggleWeapon = Character->GetToggleWeapon();
+		CurrentFOV = TargetFOV;
 	}
-
-	const float TargetFOV = bAimed ? WeaponInfo.ZoomedFOV : DefaultFOV;
-	const float CurrentFOV = FMath::FInterpTo(CameraComponent->FieldOfView, TargetFOV, DeltaTime, ZoomInterpSpeed);
 	CameraComponent->SetFieldOfView(CurrentFOV);
+
+	UpdateTickEnabled();
+}
+
+float AMultiShootGameFPSCamera::GetTargetFOV() const
+{
+	return bAimed ? WeaponInfo.ZoomedFOV : DefaultFOV;
+}
+
+void AMultiShootGameFPSCamera::UpdateTickEnabled()
+{
+	SetActorTickEnabled(bViewActive || CameraComponent->FieldOfView != GetTargetFOV());
+}
+
+void AMultiShootGameFPSCamera::SetViewState(float NewSpeed, bool bNewFired, bool bNewAimed, bool bNewReloading,
+                                            bool bNewToggleWeapon)
+{
+	Speed = NewSpeed;
+	bFired = bNewFired;
+	bReloading = bNewReloading;
+	bToggleWeapon = bNewToggleWeapon;
+
+	if (bAimed != bNewAimed)
+	{
+		bAimed = bNewAimed;
+
+		UpdateTickEnabled();
+	}
+}
+
+void AMultiShootGameFPSCamera::SetViewActive(bool bNewViewActive)
+{
+	bViewActive = bNewViewActive;
+
+	UpdateTickEnabled();
 }
 
 void AMultiShootGameFPSCamera::Fire()
@@ -93,16 +134,9 @@ void AMultiShootGameFPSCamera::Fire()
 					                               SpawnParameters);
 				CurrentProjectile->ProjectileInitialize(WeaponInfo.BaseDamage);
 
-				if (WeaponInfo.FireSoundCue)
-				{
-					UGameplayStatics::PlaySoundAtLocation(GetWorld(), WeaponInfo.FireSoundCue, MuzzleLocation);
-				}
+				PlayFireSound();
 
-				if (WeaponInfo.MuzzleEffect)
-				{
-					UGameplayStatics::SpawnEmitterAttached(WeaponInfo.MuzzleEffect, WeaponMeshComponent,
-					                                       MuzzleSocketName);
-				}
+				PlayMuzzleFlash();
 
 				if (BulletShellClass)
 				{
@@ -118,11 +152,7 @@ void AMultiShootGameFPSCamera::Fire()
 			{
 				MyOwner->Fire_Server(WeaponInfo, MuzzleLocation, ShotTargetDirection, MuzzleSocketName);
 
-				if (WeaponInfo.MuzzleEffect)
-				{
-					UGameplayStatics::SpawnEmitterAttached(WeaponInfo.MuzzleEffect, WeaponMeshComponent,
-					                                       MuzzleSocketName);
-				}
+				PlayMuzzleFlash();
 
 				if (BulletShellClass)
 				{
@@ -258,6 +288,8 @@ void AMultiShootGameFPSCamera::SetWeaponInfo(FWeaponInfo Info)
 	ArmsMeshComponent->SetRelativeTransform(FTransform(FQuat(FRotator::ZeroRotator),
 	                                                   Info.AimVector + FVector(0, 0, -165),
 	                                                   FVector::OneVector));
+
+	UpdateTickEnabled();
 }
 
 void AMultiShootGameFPSCamera::BeginAim(EWeaponMode WeaponMode)
@@ -63,6 +63,13 @@ protected:
 
 	UPROPERTY(BlueprintReadOnly)
 	AMultiShootGameMagazineClip* CurrentMagazineClip;
+
+	bool bViewActive = false;
+
+	float GetTargetFOV() const;
+
+	/** Ticks only while the camera is viewed or the FOV is still interpolating. */
+	void UpdateTickEnabled();
 	
 public:
 	// Called every frame
@@ -94,6 +101,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Weapon)
 	void EndAim();
 
+	/** Pushed by the owning character every frame before this camera ticks. */
+	void SetViewState(float NewSpeed, bool bNewFired, bool bNewAimed, bool bNewReloading, bool bNewToggleWeapon);
+
+	/** Called by the owning character when it makes this camera the view target or leaves it. */
+	void SetViewActive(bool bNewViewActive);
+
 	UFUNCTION(BlueprintPure, Category = Weapon)
 	FORCEINLINE UCameraComponent* GetCameraComponent() const { return CameraComponent; }
 };
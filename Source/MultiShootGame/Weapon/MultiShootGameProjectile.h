@@ -8,10 +8,11 @@
 #include "GameFramework/Actor.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "MultiShootGame/Component/HitEffectComponent.h"
+#include "MultiShootGame/Interface/MultiShootGameImpactSource.h"
 #include "MultiShootGameProjectile.generated.h"
 
 UCLASS(config=Game)
-class AMultiShootGameProjectile : public AMultiShootGameProjectileBase
+class AMultiShootGameProjectile : public AMultiShootGameProjectileBase, public IMultiShootGameImpactSource
 {
 	GENERATED_BODY()
 
@@ -47,4 +48,11 @@ protected:
 	UFUNCTION()
 	void OnBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp,
 	                    int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+public:
+	virtual const UHitEffectComponent* GetImpactHitEffect() const override { return HitEffectComponent; }
+
+	virtual UMaterialInterface* GetImpactDecalMaterial() const override { return BulletDecalMaterial; }
+
+	virtual FVector GetImpactDecalSize() const override { return BulletDecalSize; }
 };
@@ -2,6 +2,9 @@
 
 
 #include "MultiShootGameProjectileBase.h"
+#include "MultiShootGame/GameMode/MultiShootGameMatchInstance.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
+#include "MultiShootGame/Subsystem/AnimationBudgetSubsystem.h"
 
 // Sets default values
 AMultiShootGameProjectileBase::AMultiShootGameProjectileBase()
@@ -18,6 +21,45 @@ AMultiShootGameProjectileBase::AMultiShootGameProjectileBase()
 void AMultiShootGameProjectileBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Overlaps against bots are resolved on the server, where their poses may be skipped
+	UAnimationBudgetSubsystem* AnimationBudgetSubsystem = GetWorld()->GetSubsystem<UAnimationBudgetSubsystem>();
+	if (AnimationBudgetSubsystem && GetLocalRole() == ROLE_Authority)
+	{
+		AnimationBudgetSubsystem->RegisterProjectile(this);
+	}
+
+	// Pawns of other hosted matches share the level but must not stop the projectile
+	if (GetLocalRole() == ROLE_Authority)
+	{
+		TInlineComponentArray<UPrimitiveComponent*> PrimitiveComponents(this);
+		for (UPrimitiveComponent* PrimitiveComponent : PrimitiveComponents)
+		{
+			AMultiShootGameMatchInstance::IgnoreOtherMatches(this, PrimitiveComponent);
+		}
+	}
+}
+
+void AMultiShootGameProjectileBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UAnimationBudgetSubsystem* AnimationBudgetSubsystem = GetWorld()->GetSubsystem<UAnimationBudgetSubsystem>();
+	if (AnimationBudgetSubsystem)
+	{
+		AnimationBudgetSubsystem->UnregisterProjectile(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool AMultiShootGameProjectileBase::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget,
+                                                     const FVector& SrcLocation) const
+{
+	if (!AMultiShootGamePlayerState::IsSameMatch(this, RealViewer))
+	{
+		return false;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
 }
 
 // Called every frame
@@ -3,6 +3,7 @@
 
 #include "MultiShootGameRocket.h"
 #include "Kismet/GameplayStatics.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
 #include "Particles/ParticleSystemComponent.h"
 
 AMultiShootGameRocket::AMultiShootGameRocket()
@@ -66,7 +67,7 @@ void AMultiShootGameRocket::OnBeginOverlap(UPrimitiveComponent* OverlappedCompon
                                            UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
                                            const FHitResult& SweepResult)
 {
-	if (OtherActor == GetOwner())
+	if (OtherActor == GetOwner() || !AMultiShootGamePlayerState::IsSameMatch(this, OtherActor))
 	{
 		return;
 	}
@@ -5,6 +5,8 @@
 #include "Kismet/GameplayStatics.h"
 #include "MultiShootGame/MultiShootGame.h"
 #include "MultiShootGame/Character/MultiShootGameCharacter.h"
+#include "MultiShootGame/GameMode/MultiShootGamePlayerState.h"
+#include "MultiShootGame/Subsystem/ImpactEventSubsystem.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 
 AMultiShootGameShotgun::AMultiShootGameShotgun()
@@ -139,10 +141,8 @@ void AMultiShootGameShotgun::OnHit(UPrimitiveComponent* HitComp, AActor* OtherAc
 {
 	const EPhysicalSurface SurfaceType = UPhysicalMaterial::DetermineSurfaceType(Hit.PhysMaterial.Get());
 
-	UGameplayStatics::SpawnDecalAttached(BulletDecalMaterial, BulletDecalSize, OtherComp, NAME_None, Hit.Location,
-	                                     Hit.ImpactNormal.Rotation(), EAttachLocation::KeepWorldPosition, 10.f);
-
-	HitEffectComponent->PlayHitEffect(SurfaceType, Hit.Location, GetActorRotation());
+	UImpactEventSubsystem::RecordImpact(this, Hit.Location, Hit.ImpactNormal, GetActorForwardVector(), SurfaceType,
+	                                    true);
 
 	HitComp->DestroyComponent();
 }
@@ -151,35 +151,35 @@ void AMultiShootGameShotgun::OnBeginOverlap(UPrimitiveComponent* OverlappedCompo
                                             UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
                                             const FHitResult& SweepResult)
 {
-	if (OtherActor == GetOwner())
+	if (OtherActor == GetOwner() || !AMultiShootGamePlayerState::IsSameMatch(this, OtherActor))
 	{
 		return;
 	}
 
 	const EPhysicalSurface SurfaceType = UPhysicalMaterial::DetermineSurfaceType(SweepResult.PhysMaterial.Get());
+	const bool bHitCharacter = Cast<ACharacter>(OtherActor) != nullptr;
 
-	if (Cast<ACharacter>(OtherActor))
+	if (bHitCharacter)
 	{
-		if (SurfaceType == SURFACE_HEAD)
-		{
-			BaseDamage *= 2.5f;
+		bool bHeadShot = false;
+		const float Damage = BaseDamage * UHealthComponent::GetHitZoneMultiplier(
+			OtherActor, OtherComp, OtherBodyIndex, bHeadShot);
 
-			Cast<UHealthComponent>(OtherActor->GetComponentByClass(UHealthComponent::StaticClass()))->OnHeadShot.
-				Broadcast(GetOwner());
+		if (bHeadShot)
+		{
+			UHealthComponent* HealthComponent = UHealthComponent::FindHealthComponent(OtherActor);
+			if (HealthComponent)
+			{
+				HealthComponent->NotifyHeadShot(GetOwner());
+			}
 		}
 
-		UGameplayStatics::ApplyPointDamage(OtherActor, BaseDamage, GetActorRotation().Vector(), SweepResult,
+		UGameplayStatics::ApplyPointDamage(OtherActor, Damage, GetActorRotation().Vector(), SweepResult,
 		                                   GetOwner()->GetInstigatorController(), GetOwner(), DamageTypeClass);
 	}
-	else
-	{
-		UGameplayStatics::SpawnDecalAttached(BulletDecalMaterial, BulletDecalSize, OtherComp, NAME_None,
-		                                     SweepResult.Location,
-		                                     SweepResult.ImpactNormal.Rotation(), EAttachLocation::KeepWorldPosition,
-		                                     10.f);
-	}
 
-	HitEffectComponent->PlayHitEffect(SurfaceType, SweepResult.Location, GetActorRotation());
+	UImpactEventSubsystem::RecordImpact(this, SweepResult.Location, SweepResult.ImpactNormal,
+	                                    GetActorForwardVector(), SurfaceType, !bHitCharacter);
 
 	OverlappedComponent->DestroyComponent();
 }
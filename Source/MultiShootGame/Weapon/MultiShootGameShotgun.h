@@ -7,13 +7,15 @@
 #include "Components/BoxComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "MultiShootGame/Component/HitEffectComponent.h"
+#include "MultiShootGame/Interface/MultiShootGameImpactSource.h"
 #include "MultiShootGameShotgun.generated.h"
 
 /**
  * 
  */
 UCLASS()
-class MULTISHOOTGAME_API AMultiShootGameShotgun : public AMultiShootGameProjectileBase
+class MULTISHOOTGAME_API AMultiShootGameShotgun : public AMultiShootGameProjectileBase,
+                                                  public IMultiShootGameImpactSource
 {
 	GENERATED_BODY()
 
@@ -69,4 +71,11 @@ protected:
 	UFUNCTION()
 	void OnBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp,
 						int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+public:
+	virtual const UHitEffectComponent* GetImpactHitEffect() const override { return HitEffectComponent; }
+
+	virtual UMaterialInterface* GetImpactDecalMaterial() const override { return BulletDecalMaterial; }
+
+	virtual FVector GetImpactDecalSize() const override { return BulletDecalSize; }
 };
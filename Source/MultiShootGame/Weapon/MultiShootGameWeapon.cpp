@@ -7,7 +7,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "MultiShootGame/GameMode/MultiShootGameGameMode.h"
-#include "MultiShootGame/SaveGame/ChooseWeaponSaveGame.h"
+#include "MultiShootGame/Subsystem/LoadoutSubsystem.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Net/UnrealNetwork.h"
 
@@ -23,6 +23,12 @@ AMultiShootGameWeapon::AMultiShootGameWeapon()
 	WeaponMeshComponent->SetupAttachment(RootComponent);
 	WeaponMeshComponent->SetCastHiddenShadow(true);
 	WeaponMeshComponent->SetIsReplicated(true);
+
+	MuzzleFlashComponent = CreateDefaultSubobject<UMuzzleFlashComponent>(TEXT("MuzzleFlashComponent"));
+	MuzzleFlashComponent->SetupAttachment(WeaponMeshComponent, MuzzleSocketName);
+
+	WeaponAudioComponent = CreateDefaultSubobject<UWeaponAudioComponent>(TEXT("WeaponAudioComponent"));
+	WeaponAudioComponent->SetupAttachment(WeaponMeshComponent, MuzzleSocketName);
 }
 
 // Called when the game starts or when spawned
@@ -30,35 +36,64 @@ void AMultiShootGameWeapon::BeginPlay()
 {
 	Super::BeginPlay();
 
-	AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(GetOwner());
+	// The socket can be renamed per blueprint after the constructor attached the muzzle components
+	MuzzleFlashComponent->AttachToComponent(WeaponMeshComponent,
+	                                        FAttachmentTransformRules::SnapToTargetNotIncludingScale, MuzzleSocketName);
+	WeaponAudioComponent->AttachToComponent(WeaponMeshComponent,
+	                                        FAttachmentTransformRules::SnapToTargetNotIncludingScale, MuzzleSocketName);
+
+	TimeBetweenShots = 60.0f / WeaponInfo.RateOfFire;
+
+	const AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(GetOwner());
 	if (Character->IsLocallyControlled())
 	{
-		const UChooseWeaponSaveGame* SaveGame = Cast<UChooseWeaponSaveGame>(
-			UGameplayStatics::LoadGameFromSlot(TEXT("ChooseWeapon"), 0));
-		if (SaveGame)
+		ULoadoutSubsystem* LoadoutSubsystem = ULoadoutSubsystem::Get(this);
+		if (bUseSavedLoadout && LoadoutSubsystem && !LoadoutSubsystem->IsLoadoutLoaded())
 		{
-			TArray<FWeaponInfo> WeaponInfoList;
-			switch (CurrentWeaponMode)
-			{
-			case EWeaponMode::MainWeapon:
-				WeaponInfoList = SaveGame->MainWeaponList;
-				WeaponInfo = WeaponInfoList[SaveGame->MainWeaponIndex];
-				break;
-			case EWeaponMode::SecondWeapon:
-				WeaponInfoList = SaveGame->SecondWeaponList;
-				WeaponInfo = WeaponInfoList[SaveGame->SecondWeaponIndex];
-				break;
-			case EWeaponMode::ThirdWeapon:
-				WeaponInfoList = SaveGame->ThirdWeaponList;
-				WeaponInfo = WeaponInfoList[SaveGame->ThirdWeaponIndex];
-				break;
-			}
+			LoadoutSubsystem->OnLoadoutLoaded.AddUObject(this, &AMultiShootGameWeapon::OnLoadoutLoaded);
+		}
+		else
+		{
+			OnLoadoutLoaded();
 		}
+	}
+}
 
-		bInitializeReady = true;
+void AMultiShootGameWeapon::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ULoadoutSubsystem* LoadoutSubsystem = ULoadoutSubsystem::Get(this);
+	if (LoadoutSubsystem)
+	{
+		LoadoutSubsystem->OnLoadoutLoaded.RemoveAll(this);
 	}
 
-	TimeBetweenShots = 60.0f / WeaponInfo.RateOfFire;
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMultiShootGameWeapon::OnLoadoutLoaded()
+{
+	ULoadoutSubsystem* LoadoutSubsystem = ULoadoutSubsystem::Get(this);
+	if (LoadoutSubsystem)
+	{
+		LoadoutSubsystem->OnLoadoutLoaded.RemoveAll(this);
+	}
+
+	const FWeaponInfo* SelectedWeaponInfo = bUseSavedLoadout && LoadoutSubsystem
+		                                        ? LoadoutSubsystem->GetSelectedWeaponInfo(CurrentWeaponMode)
+		                                        : nullptr;
+	if (SelectedWeaponInfo)
+	{
+		WeaponInfo = *SelectedWeaponInfo;
+		TimeBetweenShots = 60.0f / WeaponInfo.RateOfFire;
+	}
+
+	bInitializeReady = true;
+
+	AMultiShootGameCharacter* Character = Cast<AMultiShootGameCharacter>(GetOwner());
+	if (Character)
+	{
+		Character->TryInitializeLoadout();
+	}
 }
 
 void AMultiShootGameWeapon::Fire()
@@ -102,16 +137,9 @@ void AMultiShootGameWeapon::Fire()
 					                               SpawnParameters);
 				CurrentProjectile->ProjectileInitialize(WeaponInfo.BaseDamage);
 
-				if (WeaponInfo.FireSoundCue)
-				{
-					UGameplayStatics::PlaySoundAtLocation(GetWorld(), WeaponInfo.FireSoundCue, MuzzleLocation);
-				}
+				PlayFireSound();
 
-				if (WeaponInfo.MuzzleEffect)
-				{
-					UGameplayStatics::SpawnEmitterAttached(WeaponInfo.MuzzleEffect, WeaponMeshComponent,
-					                                       MuzzleSocketName);
-				}
+				PlayMuzzleFlash();
 
 				if (BulletShellClass)
 				{
@@ -187,9 +215,23 @@ void AMultiShootGameWeapon::StopFire()
 {
 	GetWorldTimerManager().ClearTimer(TimerHandle);
 
+	MuzzleFlashComponent->StopMuzzleFlash();
+	WeaponAudioComponent->StopFireSound();
+
 	StopFireCurve();
 }
 
+void AMultiShootGameWeapon::PlayMuzzleFlash()
+{
+	MuzzleFlashComponent->PlayMuzzleFlash(WeaponInfo.MuzzleEffect, WeaponInfo.MuzzleBurstEffect);
+}
+
+void AMultiShootGameWeapon::PlayFireSound()
+{
+	WeaponAudioComponent->PlayFireSound(WeaponInfo.FireSoundCue, WeaponInfo.FireLoopSoundCue,
+	                                    WeaponInfo.FireTailSoundCue, WeaponInfo.FireSoundConcurrency);
+}
+
 void AMultiShootGameWeapon::FireOfDelay()
 {
 	if (LastFireTime == 0)
@@ -6,6 +6,8 @@
 #include "MultiShootGameBulletShell.h"
 #include "MultiShootGameMagazineClip.h"
 #include "GameFramework/Pawn.h"
+#include "MultiShootGame/Component/MuzzleFlashComponent.h"
+#include "MultiShootGame/Component/WeaponAudioComponent.h"
 #include "MultiShootGame/Enum/EWeaponMode.h"
 #include "MultiShootGame/Struct/WeaponInfo.h"
 #include "MultiShootGameWeapon.generated.h"
@@ -25,6 +27,14 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Takes the pick from the loadout cache once it has been read, then reports readiness to the character. */
+	void OnLoadoutLoaded();
+
+	/** False for weapons whose info is pushed by the character rather than picked in the choose weapon menu. */
+	bool bUseSavedLoadout = true;
+
 	virtual bool BulletCheck(AMultiShootGameCharacter* MyOwner);
 
 	virtual void BulletFire(AMultiShootGameCharacter* MyOwner);
@@ -32,6 +42,12 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components)
 	USkeletalMeshComponent* WeaponMeshComponent;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components)
+	UMuzzleFlashComponent* MuzzleFlashComponent;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Components)
+	UWeaponAudioComponent* WeaponAudioComponent;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
 	FName MuzzleSocketName = "Muzzle";
 
@@ -88,6 +104,10 @@ public:
 
 	void FillUpBullet();
 
+	void PlayMuzzleFlash();
+
+	void PlayFireSound();
+
 	bool bInitializeReady = false;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Weapon)
@@ -95,4 +115,10 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = Weapon)
 	FORCEINLINE USkeletalMeshComponent* GetWeaponMeshComponent() const { return WeaponMeshComponent; }
+
+	UFUNCTION(BlueprintPure, Category = Weapon)
+	FORCEINLINE UMuzzleFlashComponent* GetMuzzleFlashComponent() const { return MuzzleFlashComponent; }
+
+	UFUNCTION(BlueprintPure, Category = Weapon)
+	FORCEINLINE UWeaponAudioComponent* GetWeaponAudioComponent() const { return WeaponAudioComponent; }
 };